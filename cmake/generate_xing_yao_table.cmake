@@ -0,0 +1,122 @@
+# ==============================================================================
+# 星耀特性数据库生成脚本
+# ==============================================================================
+#
+# 构建时把 src/zi_wei/data/xing_yao.json 转换为 C++ 常量表，
+# 由 zi_wei_star_description.cpp 包含，运行时不再解析 JSON。
+#
+# 用法（由 CMakeLists.txt 中的 add_custom_command 调用）:
+#   cmake -DINPUT=<xing_yao.json> -DOUTPUT=<zi_wei_xing_yao_table.inc> -P generate_xing_yao_table.cmake
+#
+# JSON 格式：按分类（主星、辅星、煞星、杂耀）分组的数组，每项包含
+#   - name: 星耀名称（须为 StarId 收录的名称，编译期校验）
+#   - te_xing: 特性列表（桃花星、财星、权星、文星、寿星、驿马星、孤星、吉星、煞星、主星、辅星、杂耀）
+#   - wu_xing: 五行属性（金、木、水、火、土）
+#   - yin_yang: 阴阳属性（阳、阴）
+#   - xing_qing: 星情描述
+#   - zhu_shi: 主管事项
+#
+# 未知的特性、五行或阴阳直接报错，不在运行时静默回退。
+#
+
+if(NOT INPUT OR NOT OUTPUT)
+    message(FATAL_ERROR "需要指定 -DINPUT=<json> 与 -DOUTPUT=<inc>")
+endif()
+
+file(READ "${INPUT}" XING_YAO_JSON)
+
+# 中文取值到枚举名
+set(TE_XING_桃花星 TaoHua)
+set(TE_XING_财星 CaiXing)
+set(TE_XING_权星 QuanXing)
+set(TE_XING_文星 WenXing)
+set(TE_XING_寿星 ShouXing)
+set(TE_XING_驿马星 YiMaXing)
+set(TE_XING_孤星 GuXing)
+set(TE_XING_吉星 JiXing)
+set(TE_XING_煞星 ShaXing)
+set(TE_XING_主星 ZhuXing)
+set(TE_XING_辅星 FuXing)
+set(TE_XING_杂耀 ZaYao)
+
+set(WU_XING_金 Jin)
+set(WU_XING_木 Mu)
+set(WU_XING_水 Shui)
+set(WU_XING_火 Huo)
+set(WU_XING_土 Tu)
+
+set(YIN_YANG_阳 Yang)
+set(YIN_YANG_阴 Yin)
+
+# 取字符串字段并转义为 C++ 字符串字面量内容
+function(read_string_field out json key)
+    string(JSON value GET "${json}" ${key})
+    string(REPLACE "\\" "\\\\" value "${value}")
+    string(REPLACE "\"" "\\\"" value "${value}")
+    set(${out} "${value}" PARENT_SCOPE)
+endfunction()
+
+set(ROWS "")
+set(ROW_COUNT 0)
+
+string(JSON CATEGORY_COUNT LENGTH "${XING_YAO_JSON}")
+math(EXPR CATEGORY_LAST "${CATEGORY_COUNT} - 1")
+foreach(category_index RANGE ${CATEGORY_LAST})
+    string(JSON category MEMBER "${XING_YAO_JSON}" ${category_index})
+    string(JSON stars GET "${XING_YAO_JSON}" "${category}")
+    string(JSON star_count LENGTH "${stars}")
+    if(star_count EQUAL 0)
+        continue()
+    endif()
+
+    string(APPEND ROWS "        // ${category}\n")
+    math(EXPR star_last "${star_count} - 1")
+    foreach(star_index RANGE ${star_last})
+        string(JSON star GET "${stars}" ${star_index})
+
+        read_string_field(name "${star}" name)
+        read_string_field(xing_qing "${star}" xing_qing)
+        read_string_field(zhu_shi "${star}" zhu_shi)
+
+        # 特性列表
+        set(te_xing_items "")
+        string(JSON te_xing_count LENGTH "${star}" te_xing)
+        if(te_xing_count GREATER 0)
+            math(EXPR te_xing_last "${te_xing_count} - 1")
+            foreach(te_xing_index RANGE ${te_xing_last})
+                string(JSON te_xing GET "${star}" te_xing ${te_xing_index})
+                if(NOT DEFINED TE_XING_${te_xing})
+                    message(FATAL_ERROR "${INPUT}: ${name} 的特性“${te_xing}”未知")
+                endif()
+                list(APPEND te_xing_items "XingYaoTeXing::${TE_XING_${te_xing}}")
+            endforeach()
+        endif()
+        list(JOIN te_xing_items ", " te_xing_list)
+
+        string(JSON wu_xing GET "${star}" wu_xing)
+        if(NOT DEFINED WU_XING_${wu_xing})
+            message(FATAL_ERROR "${INPUT}: ${name} 的五行“${wu_xing}”未知")
+        endif()
+
+        string(JSON yin_yang GET "${star}" yin_yang)
+        if(NOT DEFINED YIN_YANG_${yin_yang})
+            message(FATAL_ERROR "${INPUT}: ${name} 的阴阳“${yin_yang}”未知")
+        endif()
+
+        string(APPEND ROWS
+            "        make_record(\"${name}\"sv, {${te_xing_list}},\n"
+            "            XingYaoWuXing::${WU_XING_${wu_xing}}, XingYaoYinYang::${YIN_YANG_${yin_yang}},\n"
+            "            \"${xing_qing}\"sv,\n"
+            "            \"${zhu_shi}\"sv),\n"
+        )
+        math(EXPR ROW_COUNT "${ROW_COUNT} + 1")
+    endforeach()
+endforeach()
+
+set(CONTENT "// 由 cmake/generate_xing_yao_table.cmake 根据 src/zi_wei/data/xing_yao.json 生成，请勿手动修改\n")
+string(APPEND CONTENT "// 共 ${ROW_COUNT} 颗星耀\n\n")
+string(APPEND CONTENT "    constexpr array XING_YAO_RECORDS = {\n")
+string(APPEND CONTENT "${ROWS}")
+string(APPEND CONTENT "    };\n")
+
+file(WRITE "${OUTPUT}" "${CONTENT}")
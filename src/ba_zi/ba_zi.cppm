@@ -318,16 +318,8 @@ struct LiuNian {
  * @return LiuNian 流年对象
  */
 inline LiuNian create_liu_nian(int year, int birth_year, TianGan day_gan) {
-    // 从年份获取干支
-    auto solar_day = tyme::SolarDay::from_ymd(year, 1, 1);
-    auto lunar_day = solar_day.get_lunar_day();
-    auto lunar_year = lunar_day.get_lunar_month().get_lunar_year();
-    auto year_cycle = lunar_year.get_sixty_cycle();
-    
-    // 转换为 Pillar
-    std::string gan_name = year_cycle.get_heaven_stem().get_name();
-    std::string zhi_name = year_cycle.get_earth_branch().get_name();
-    Pillar year_pillar(gan_name, zhi_name);
+    // 流年以立春为界，取该年立春后的年柱（公元 4 年为甲子年）
+    Pillar year_pillar = Pillar::from_sixty_cycle_index(((year - 4) % 60 + 60) % 60);
     
     // 计算虚岁
     int age = year - birth_year + 1;
@@ -384,16 +376,10 @@ struct LiuYue {
  * @return LiuYue 流月对象
  */
 inline LiuYue create_liu_yue(int year, int month, TianGan day_gan) {
-    // 从年月获取干支（取月中某日）
-    auto solar_time = tyme::SolarTime::from_ymd_hms(year, month, 15, 12, 0, 0);
-    auto lunar_hour = solar_time.get_lunar_hour();
-    auto eight_char = lunar_hour.get_eight_char();
-    auto month_cycle = eight_char.get_month();
-    
-    // 转换为 Pillar
-    std::string gan_name = month_cycle.get_heaven_stem().get_name();
-    std::string zhi_name = month_cycle.get_earth_branch().get_name();
-    Pillar month_pillar(gan_name, zhi_name);
+    // 取月中（15 日）的月柱：各月的节都在 4～8 日，月中总在本月节之后，
+    // 因此公历每月恰对应一个月柱，月柱六十甲子逐月加一（公元 0 年 1 月为乙丑月）
+    int months = year * 12 + (month - 1);
+    Pillar month_pillar = Pillar::from_sixty_cycle_index(((months + 13) % 60 + 60) % 60);
     
     return LiuYue(year, month, month_pillar, day_gan);
 }
@@ -511,8 +497,93 @@ inline LiuShi create_liu_shi(int year, int month, int day, int hour, TianGan day
     return LiuShi(hour, bazi.hour, day_gan);
 }
 
+// ==================== 流运区间 ====================
+
+/**
+ * @brief 连续多年的流年，写入 out（清空后追加，保留容量以便复用）
+ * 
+ * @param start_year 起始公历年份
+ * @param count 年数
+ */
+inline void liu_nian_range(int start_year, int count, int birth_year, TianGan day_gan,
+                           std::vector<LiuNian>& out) {
+    out.clear();
+    out.reserve(std::max(count, 0));
+    for (int i = 0; i < count; ++i) {
+        out.push_back(create_liu_nian(start_year + i, birth_year, day_gan));
+    }
+}
+
+/**
+ * @brief 一年十二个月的流月（公历 1～12 月），写入 out
+ */
+inline void liu_yue_range(int year, TianGan day_gan, std::vector<LiuYue>& out) {
+    out.clear();
+    out.reserve(12);
+    for (int month = 1; month <= 12; ++month) {
+        out.push_back(create_liu_yue(year, month, day_gan));
+    }
+}
+
+/**
+ * @brief 从 start 起连续 days 天的流日，写入 out
+ * 
+ * 只为首日排一次日柱，此后日柱逐日加一，日期按公历逐日推进
+ * （1582 年 10 月 4 日之后为 10 月 15 日，与 tyme 一致）。
+ */
+inline void liu_ri_range(const BaZiBase::SolarDate& start, int days, TianGan day_gan,
+                         std::vector<LiuRi>& out) {
+    out.clear();
+    if (days <= 0) {
+        return;
+    }
+    out.reserve(days);
+    
+    int cycle = create_liu_ri(start.year, start.month, start.day, day_gan).pillar.to_sixty_cycle_index();
+    int year = start.year;
+    int month = start.month;
+    int day = start.day;
+    int month_days = tyme::SolarMonth::from_ym(year, month).get_day_count();
+    
+    for (int i = 0; i < days; ++i) {
+        out.emplace_back(year, month, day, Pillar::from_sixty_cycle_index(cycle), day_gan);
+        cycle = (cycle + 1) % 60;
+        
+        if (year == 1582 && month == 10 && day == 4) {
+            day = 15;
+        } else if (++day > month_days + (year == 1582 && month == 10 ? 10 : 0)) {
+            day = 1;
+            if (++month > 12) {
+                month = 1;
+                ++year;
+            }
+            month_days = tyme::SolarMonth::from_ym(year, month).get_day_count();
+        }
+    }
+}
+
 // ==================== 完整八字排盘结果 ====================
 
+/**
+ * @brief 排盘内容（位标志）
+ * 
+ * 四柱、旬空与十神总是计算；大运依赖童限（节气搜索），代价最高，
+ * 未请求时推迟到首次访问再算。
+ */
+enum class PaiPanPart : std::uint8_t {
+    SiZhu = 1 << 0,         // 四柱、旬空、十神
+    DaYun = 1 << 1,         // 童限与大运
+    All = SiZhu | DaYun
+};
+
+constexpr PaiPanPart operator|(PaiPanPart a, PaiPanPart b) {
+    return static_cast<PaiPanPart>(static_cast<std::uint8_t>(a) | static_cast<std::uint8_t>(b));
+}
+
+constexpr bool has_part(PaiPanPart parts, PaiPanPart part) {
+    return (static_cast<std::uint8_t>(parts) & static_cast<std::uint8_t>(part)) != 0;
+}
+
 /**
  * @brief 完整八字排盘结果
  * 
@@ -527,13 +598,41 @@ struct BaZiResult {
     int birth_hour;                 // 出生时辰
     int birth_minute;               // 出生分钟
     int birth_second;               // 出生秒
-    DaYunSystem da_yun_system;      // 大运系统
     
+    /**
+     * @param parts 需要预先计算的内容；不含 DaYun 时不计算童限，
+     *              直到首次调用 get_da_yun_system 等大运接口
+     */
     BaZiResult(const BaZiBase::BaZi& bz, bool male, int by, int bm, int bd, int bh, 
-               int bmin = 0, int bsec = 0)
+               int bmin = 0, int bsec = 0, PaiPanPart parts = PaiPanPart::All)
         : ba_zi(bz), is_male(male), birth_year(by), birth_month(bm), 
           birth_day(bd), birth_hour(bh), birth_minute(bmin), birth_second(bsec),
-          da_yun_system(bz, male, by, bm, bd, bh, bmin, bsec) {}
+          da_yun_(std::make_shared<LazyDaYun>()) {
+        if (has_part(parts, PaiPanPart::DaYun)) {
+            get_da_yun_system();
+        }
+    }
+    
+    /**
+     * @brief 获取大运系统（首次访问时计算，线程安全）
+     * 
+     * 结果的各个副本共享同一份大运，任一副本算过后其余副本直接复用。
+     */
+    const DaYunSystem& get_da_yun_system() const {
+        std::call_once(da_yun_->once, [this] {
+            da_yun_->value.emplace(ba_zi, is_male, birth_year, birth_month, birth_day,
+                                   birth_hour, birth_minute, birth_second);
+            da_yun_->ready.store(true, std::memory_order_release);
+        });
+        return *da_yun_->value;
+    }
+    
+    /**
+     * @brief 大运是否已经算出
+     */
+    bool has_da_yun_system() const {
+        return da_yun_->ready.load(std::memory_order_acquire);
+    }
     
     /**
      * @brief 获取指定年份的流年
@@ -556,6 +655,27 @@ struct BaZiResult {
         return create_liu_ri(year, month, day, ba_zi.day.gan);
     }
     
+    /**
+     * @brief 从 start_year 起连续 count 年的流年，写入 out
+     */
+    void liu_nian_range(int start_year, int count, std::vector<LiuNian>& out) const {
+        ZhouYi::BaZi::liu_nian_range(start_year, count, birth_year, ba_zi.day.gan, out);
+    }
+    
+    /**
+     * @brief 指定年份十二个月的流月，写入 out
+     */
+    void liu_yue_range(int year, std::vector<LiuYue>& out) const {
+        ZhouYi::BaZi::liu_yue_range(year, ba_zi.day.gan, out);
+    }
+    
+    /**
+     * @brief 从 start 起连续 days 天的流日，写入 out
+     */
+    void liu_ri_range(const BaZiBase::SolarDate& start, int days, std::vector<LiuRi>& out) const {
+        ZhouYi::BaZi::liu_ri_range(start, days, ba_zi.day.gan, out);
+    }
+    
     /**
      * @brief 获取指定时辰的流时
      */
@@ -567,7 +687,7 @@ struct BaZiResult {
      * @brief 获取当前年龄的大运
      */
     std::optional<DaYun> get_current_da_yun(int age) const {
-        return da_yun_system.get_da_yun_by_age(age);
+        return get_da_yun_system().get_da_yun_by_age(age);
     }
     
     /**
@@ -576,7 +696,7 @@ struct BaZiResult {
      * 返回完整的起运信息，包括精确的年月日时分
      */
     DaYunSystem::ChildLimitDetail get_child_limit_detail() const {
-        return da_yun_system.get_child_limit_detail();
+        return get_da_yun_system().get_child_limit_detail();
     }
     
     /**
@@ -586,7 +706,7 @@ struct BaZiResult {
      * @return tyme::DecadeFortune 对象，可访问更多信息
      */
     tyme::DecadeFortune get_tyme_decade_fortune(int index) const {
-        return da_yun_system.get_tyme_decade_fortune(index);
+        return get_da_yun_system().get_tyme_decade_fortune(index);
     }
     
     /**
@@ -596,7 +716,7 @@ struct BaZiResult {
      * @return 大运列表
      */
     std::vector<tyme::DecadeFortune> get_all_tyme_decade_fortunes(int count = 10) const {
-        return da_yun_system.get_all_tyme_decade_fortunes(count);
+        return get_da_yun_system().get_all_tyme_decade_fortunes(count);
     }
     
     /**
@@ -606,7 +726,7 @@ struct BaZiResult {
      * @return tyme::Fortune 对象
      */
     tyme::Fortune get_tyme_fortune(int index) const {
-        return tyme::Fortune::from_child_limit(da_yun_system.get_child_limit(), index);
+        return tyme::Fortune::from_child_limit(get_da_yun_system().get_child_limit(), index);
     }
     
     /**
@@ -637,6 +757,7 @@ struct BaZiResult {
         };
         
         // 大运
+        const auto& da_yun_system = get_da_yun_system();
         j["da_yun"] = {
             {"qi_yun_age", da_yun_system.get_qi_yun_age()},
             {"shun_pai", da_yun_system.is_shun_pai()},
@@ -654,6 +775,18 @@ struct BaZiResult {
         
         return j;
     }
+
+private:
+    /**
+     * @brief 大运的延迟计算状态
+     */
+    struct LazyDaYun {
+        std::once_flag once;
+        std::optional<DaYunSystem> value;
+        std::atomic<bool> ready{false};
+    };
+
+    std::shared_ptr<LazyDaYun> da_yun_;
 };
 
 } // namespace ZhouYi::BaZi
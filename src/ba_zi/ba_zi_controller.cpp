@@ -21,24 +21,24 @@ using namespace ZhouYi::BaZiBase;
  * @brief 从公历排盘（实现）
  */
 BaZiResult pai_pan_solar(int year, int month, int day, int hour, 
-                         int minute, bool is_male) {
+                         int minute, bool is_male, PaiPanPart parts) {
     // 创建八字
     auto bazi = BaZi::from_solar(year, month, day, hour, minute);
     
     // 创建完整结果（包含分钟信息用于准确计算起运年龄）
-    return BaZiResult(bazi, is_male, year, month, day, hour, minute, 0);
+    return BaZiResult(bazi, is_male, year, month, day, hour, minute, 0, parts);
 }
 
 /**
  * @brief 从农历排盘（实现）
  */
 BaZiResult pai_pan_lunar(int year, int month, int day, int hour,
-                         int minute, bool is_male) {
+                         int minute, bool is_male, PaiPanPart parts) {
     // 创建八字
     auto bazi = BaZi::from_lunar(year, month, day, hour, minute);
     
     // 注意：这里使用农历年份，实际应用中可能需要转换为公历
-    return BaZiResult(bazi, is_male, year, month, day, hour, minute, 0);
+    return BaZiResult(bazi, is_male, year, month, day, hour, minute, 0, parts);
 }
 
 /**
@@ -77,15 +77,13 @@ void display_result(const BaZiResult& result) {
                  shi_shen_to_zh(shi_shen_arr[3]));
     
     // 旬空
-    if (!bazi.xun_kong_1.empty()) {
-        fmt::println("\n旬空: {}{}", bazi.xun_kong_1, bazi.xun_kong_2);
-    }
+    fmt::println("\n旬空: {}{}", GanZhi::Mapper::to_zh(bazi.xun_kong_1), GanZhi::Mapper::to_zh(bazi.xun_kong_2));
     
     fmt::println("");
     
     // 大运信息
     fmt::println("【大运】");
-    const auto& da_yun_system = result.da_yun_system;
+    const auto& da_yun_system = result.get_da_yun_system();
     fmt::println("起运年龄: {}岁", da_yun_system.get_qi_yun_age());
     fmt::println("排运方式: {}", da_yun_system.is_shun_pai() ? "顺排" : "逆排");
     fmt::println("");
@@ -109,7 +107,7 @@ void display_da_yun(const BaZiResult& result, int max_count) {
     fmt::println("==================== 大运信息 ====================");
     fmt::println("");
     
-    const auto& da_yun_list = result.da_yun_system.get_da_yun_list();
+    const auto& da_yun_list = result.get_da_yun_system().get_da_yun_list();
     int count = std::min(max_count, static_cast<int>(da_yun_list.size()));
     
     fmt::println("{:<12} {:<8} {:<8} {:<8}", "干支", "年龄", "天干十神", "地支十神");
@@ -139,12 +137,11 @@ void display_liu_nian(const BaZiResult& result, int start_year, int count) {
                  "年份", "干支", "年龄", "天干十神", "地支十神");
     fmt::println("{:-<48}", "");
     
-    for (int i = 0; i < count; ++i) {
-        int year = start_year + i;
-        auto liu_nian = result.get_liu_nian(year);
-        
+    std::vector<LiuNian> liu_nian_list;
+    result.liu_nian_range(start_year, count, liu_nian_list);
+    for (const auto& liu_nian : liu_nian_list) {
         fmt::println("{:<8} {:<8} {:<6} {:<8} {:<8}",
-                     year,
+                     liu_nian.year,
                      liu_nian.pillar.to_string(),
                      std::format("{}岁", liu_nian.age),
                      shi_shen_to_zh(liu_nian.gan_shi_shen),
@@ -166,11 +163,11 @@ void display_liu_yue(const BaZiResult& result, int year) {
                  "月份", "干支", "天干十神", "地支十神");
     fmt::println("{:-<40}", "");
     
-    for (int month = 1; month <= 12; ++month) {
-        auto liu_yue = result.get_liu_yue(year, month);
-        
+    std::vector<LiuYue> liu_yue_list;
+    result.liu_yue_range(year, liu_yue_list);
+    for (const auto& liu_yue : liu_yue_list) {
         fmt::println("{:<8} {:<8} {:<8} {:<8}",
-                     std::format("{}月", month),
+                     std::format("{}月", liu_yue.month),
                      liu_yue.pillar.to_string(),
                      shi_shen_to_zh(liu_yue.gan_shi_shen),
                      shi_shen_to_zh(liu_yue.zhi_shi_shen));
@@ -243,20 +240,184 @@ void display_tyme_decade_fortune(const BaZiResult& result, int index) {
     fmt::println("========================================================");
 }
 
+namespace {
+
+/**
+ * @brief 批量排盘的工作线程缓存
+ * 
+ * 记住本线程上一个算出的结果位置：出生时刻相同则复用其八字（跳过历法换算），
+ * 时刻与性别都相同则直接复制整份结果。该位置只由本线程写入，读取无需同步。
+ */
+class BatchWorker {
+public:
+    explicit BatchWorker(PaiPanPart parts) : parts_(parts) {}
+
+    void pai_pan(std::span<const BatchRequest> requests,
+                 std::span<std::optional<BaZiResult>> results, std::size_t i) {
+        const auto& request = requests[i];
+        if (has_last_ && same_time(requests[last_], request)) {
+            if (requests[last_].is_male == request.is_male) {
+                results[i].emplace(*results[last_]);
+            } else {
+                emplace_result(results[i], results[last_]->ba_zi, request, parts_);
+            }
+        } else {
+            auto bazi = BaZi::from_solar(request.year, request.month, request.day,
+                                         request.hour, request.minute);
+            emplace_result(results[i], bazi, request, parts_);
+        }
+        last_ = i;
+        has_last_ = true;
+    }
+
+private:
+    PaiPanPart parts_;
+    std::size_t last_ = 0;
+    bool has_last_ = false;
+
+    static bool same_time(const BatchRequest& a, const BatchRequest& b) {
+        return a.year == b.year && a.month == b.month && a.day == b.day
+            && a.hour == b.hour && a.minute == b.minute;
+    }
+
+    static void emplace_result(std::optional<BaZiResult>& slot, const BaZi& bazi,
+                               const BatchRequest& request, PaiPanPart parts) {
+        // 与 pai_pan_solar 相同的构造方式
+        slot.emplace(bazi, request.is_male, request.year, request.month, request.day,
+                     request.hour, request.minute, 0, parts);
+    }
+};
+
+/**
+ * @brief 批量排盘中出现的异常（保留输入序号最小的一个）
+ */
+class BatchError {
+public:
+    void record(std::size_t index, std::exception_ptr error) {
+        std::lock_guard lock(mutex_);
+        if (!error_ || index < index_) {
+            index_ = index;
+            error_ = std::move(error);
+        }
+        failed_.store(true, std::memory_order_relaxed);
+    }
+
+    bool failed() const {
+        return failed_.load(std::memory_order_relaxed);
+    }
+
+    void rethrow_if_failed() const {
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::size_t index_ = 0;
+    std::exception_ptr error_;
+    std::atomic<bool> failed_{false};
+};
+
+} // namespace
+
+/**
+ * @brief 批量排盘，写入预分配输出（实现）
+ * 
+ * 调用线程也作为第 0 号工作线程参与计算，线程数为 1 时不创建新线程。
+ */
+void batch_pai_pan(std::span<const BatchRequest> requests,
+                   std::span<std::optional<BaZiResult>> results,
+                   const BatchOptions& options) {
+    if (results.size() != requests.size()) {
+        throw std::invalid_argument(fmt::format(
+            "批量排盘输出区长度 {} 与请求数 {} 不符", results.size(), requests.size()));
+    }
+
+    const std::size_t count = requests.size();
+    const std::size_t chunk = std::max<std::size_t>(1, options.chunk_size);
+    const std::size_t chunk_count = (count + chunk - 1) / chunk;
+    unsigned threads = options.thread_count != 0 ? options.thread_count : std::thread::hardware_concurrency();
+    threads = static_cast<unsigned>(std::clamp<std::size_t>(threads, 1, std::max<std::size_t>(1, chunk_count)));
+
+    BatchError error;
+    std::atomic<std::size_t> next{0};
+
+    auto work = [&](unsigned worker) {
+        BatchWorker cache(options.parts);
+        // 算完一块；默认模式下遇错即返回 false
+        auto run_chunk = [&](std::size_t begin) {
+            const std::size_t end = std::min(begin + chunk, count);
+            for (std::size_t i = begin; i < end; ++i) {
+                try {
+                    cache.pai_pan(requests, results, i);
+                } catch (...) {
+                    error.record(i, std::current_exception());
+                    if (!options.deterministic) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+
+        if (options.deterministic) {
+            for (std::size_t begin = worker * chunk; begin < count; begin += threads * chunk) {
+                run_chunk(begin);
+            }
+        } else {
+            for (std::size_t begin = next.fetch_add(chunk, std::memory_order_relaxed);
+                 begin < count && !error.failed();
+                 begin = next.fetch_add(chunk, std::memory_order_relaxed)) {
+                if (!run_chunk(begin)) {
+                    break;
+                }
+            }
+        }
+    };
+
+    {
+        std::vector<std::jthread> pool;
+        pool.reserve(threads - 1);
+        for (unsigned worker = 1; worker < threads; ++worker) {
+            pool.emplace_back(work, worker);
+        }
+        work(0);
+    }
+
+    error.rethrow_if_failed();
+}
+
+/**
+ * @brief 批量排盘，返回结果列表（实现）
+ */
+std::vector<BaZiResult> batch_pai_pan(std::span<const BatchRequest> requests,
+                                      const BatchOptions& options) {
+    std::vector<std::optional<BaZiResult>> slots(requests.size());
+    batch_pai_pan(requests, slots, options);
+
+    std::vector<BaZiResult> results;
+    results.reserve(slots.size());
+    for (auto& slot : slots) {
+        results.push_back(std::move(*slot));
+    }
+    return results;
+}
+
 /**
  * @brief 批量排盘（实现）
  */
 std::vector<BaZiResult> batch_pai_pan(
     const std::vector<std::tuple<int, int, int, int, bool>>& requests) {
     
-    std::vector<BaZiResult> results;
-    results.reserve(requests.size());
+    std::vector<BatchRequest> batch;
+    batch.reserve(requests.size());
     
     for (const auto& [year, month, day, hour, is_male] : requests) {
-        results.push_back(pai_pan_solar(year, month, day, hour, 0, is_male));
+        batch.push_back({year, month, day, hour, 0, is_male});
     }
     
-    return results;
+    return batch_pai_pan(batch);
 }
 
 } // namespace ZhouYi::BaZiController
@@ -25,6 +25,7 @@ export namespace ZhouYi::BaZiController {
 using ZhouYi::BaZiBase::BaZi;
 using ZhouYi::BaZiBase::Pillar;
 using ZhouYi::BaZi::BaZiResult;
+using ZhouYi::BaZi::PaiPanPart;
 using ZhouYi::BaZi::DaYun;
 using ZhouYi::BaZi::LiuNian;
 using ZhouYi::BaZi::LiuYue;
@@ -42,6 +43,7 @@ using ZhouYi::GanZhi::shi_shen_to_zh;
  * @param hour 公历时（0-23）
  * @param minute 公历分（0-59，默认0）
  * @param is_male 是否为男性
+ * @param parts 预先计算的内容；只需四柱时传 PaiPanPart::SiZhu，跳过童限计算
  * @return BaZiResult 完整的八字排盘结果
  * 
  * @example
@@ -53,7 +55,7 @@ using ZhouYi::GanZhi::shi_shen_to_zh;
  * std::println("年柱: {}", bazi.year.to_string());
  * 
  * // 获取大运
- * for (const auto& dy : result.da_yun_system.get_da_yun_list()) {
+ * for (const auto& dy : result.get_da_yun_system().get_da_yun_list()) {
  *     std::println("{}", dy.to_string());
  * }
  * 
@@ -62,7 +64,8 @@ using ZhouYi::GanZhi::shi_shen_to_zh;
  * std::println("2024年流年: {}", liu_nian_2024.to_string());
  */
 BaZiResult pai_pan_solar(int year, int month, int day, int hour, 
-                         int minute = 0, bool is_male = true);
+                         int minute = 0, bool is_male = true,
+                         PaiPanPart parts = PaiPanPart::All);
 
 /**
  * @brief 从农历排盘
@@ -73,10 +76,12 @@ BaZiResult pai_pan_solar(int year, int month, int day, int hour,
  * @param hour 时辰（0-23）
  * @param minute 分钟（0-59，默认0）
  * @param is_male 是否为男性
+ * @param parts 预先计算的内容
  * @return BaZiResult 完整的八字排盘结果
  */
 BaZiResult pai_pan_lunar(int year, int month, int day, int hour,
-                         int minute = 0, bool is_male = true);
+                         int minute = 0, bool is_male = true,
+                         PaiPanPart parts = PaiPanPart::All);
 
 /**
  * @brief 显示八字排盘结果（控制台输出）
@@ -129,6 +134,56 @@ void display_child_limit_detail(const BaZiResult& result);
  */
 void display_tyme_decade_fortune(const BaZiResult& result, int index);
 
+/**
+ * @brief 批量排盘请求（公历）
+ */
+struct BatchRequest {
+    int year;
+    int month;
+    int day;
+    int hour;
+    int minute = 0;
+    bool is_male = true;
+};
+
+/**
+ * @brief 批量排盘选项
+ */
+struct BatchOptions {
+    unsigned thread_count = 1;      // 工作线程数，0 表示按硬件并发数
+    std::size_t chunk_size = 256;   // 每次领取的请求数
+    
+    /**
+     * 确定模式：第 k 块固定由第 k % 线程数 个线程计算，出错时仍算完全部请求，
+     * 并总是抛出输入序号最小的那个异常。
+     * 默认模式下各线程从共享计数器领块，任一请求出错即停止领取。
+     * 两种模式的结果都按输入顺序写出，内容相同。
+     */
+    bool deterministic = false;
+    
+    PaiPanPart parts = PaiPanPart::All;     // 预先计算的内容，同 pai_pan_solar
+};
+
+/**
+ * @brief 批量排盘，结果按输入顺序写入预先分配的 results
+ * 
+ * 每个工作线程持有自己的缓存：与上一请求出生时刻相同时复用已算出的八字，
+ * 时刻与性别都相同时直接复制上一结果，按出生时间排序的输入受益最多。
+ * 
+ * @param requests 批量请求
+ * @param results 输出区，长度须与 requests 相同（原有内容被覆盖）
+ * @throws std::invalid_argument results 长度不符
+ */
+void batch_pai_pan(std::span<const BatchRequest> requests,
+                   std::span<std::optional<BaZiResult>> results,
+                   const BatchOptions& options = {});
+
+/**
+ * @brief 批量排盘（返回新的结果列表）
+ */
+std::vector<BaZiResult> batch_pai_pan(std::span<const BatchRequest> requests,
+                                      const BatchOptions& options = {});
+
 /**
  * @brief 批量排盘
  * 
@@ -51,6 +51,20 @@ struct Pillar {
      */
     constexpr Pillar(TianGan g, DiZhi z) : gan(g), zhi(z) {}
 
+    /**
+     * @brief 由六十甲子序号构造（0 为甲子，59 为癸亥）
+     */
+    static constexpr Pillar from_sixty_cycle_index(int index) {
+        return Pillar(static_cast<TianGan>(index % 10), static_cast<DiZhi>(index % 12));
+    }
+
+    /**
+     * @brief 由 tyme 六十甲子构造（按序号换算，不经过名称字符串）
+     */
+    static Pillar from_sixty_cycle(const tyme::SixtyCycle& cycle) {
+        return from_sixty_cycle_index(cycle.get_index());
+    }
+
     /**
      * @brief 从字符串构造（辅助构造函数）
      * 
@@ -80,6 +94,26 @@ struct Pillar {
 
     // ==================== 转换函数 ====================
     
+    /**
+     * @brief 六十甲子序号（干支阴阳不配时无意义）
+     */
+    constexpr int to_sixty_cycle_index() const {
+        // 序号 i 满足 i % 10 == 干、i % 12 == 支，即 i ≡ 6·干 − 5·支 (mod 60)
+        return ((6 * static_cast<int>(gan) - 5 * static_cast<int>(zhi)) % 60 + 60) % 60;
+    }
+
+    /**
+     * @brief 本旬旬空的两个地支（如甲子旬空戌亥）
+     */
+    constexpr std::array<DiZhi, 2> get_xun_kong() const {
+        // 旬首序号为 i - 干，旬内十个干配完后余下的两支即为旬空
+        int xun_shou = to_sixty_cycle_index() - static_cast<int>(gan);
+        return {
+            static_cast<DiZhi>((xun_shou + 10) % 12),
+            static_cast<DiZhi>((xun_shou + 11) % 12)
+        };
+    }
+
     /**
      * @brief 转换为完整字符串
      * @return 如 "甲子"
@@ -141,16 +175,8 @@ private:
      * @brief 字符串转天干枚举
      */
     static TianGan string_to_tian_gan(std::string_view str) {
-        static const std::unordered_map<std::string_view, TianGan> map = {
-            {"甲", TianGan::Jia}, {"乙", TianGan::Yi}, 
-            {"丙", TianGan::Bing}, {"丁", TianGan::Ding},
-            {"戊", TianGan::Wu}, {"己", TianGan::Ji},
-            {"庚", TianGan::Geng}, {"辛", TianGan::Xin},
-            {"壬", TianGan::Ren}, {"癸", TianGan::Gui}
-        };
-        
-        if (auto it = map.find(str); it != map.end()) {
-            return it->second;
+        if (auto gan = Mapper::from_zh_gan(str)) {
+            return *gan;
         }
         throw std::invalid_argument(std::string("无效的天干: ") + std::string(str));
     }
@@ -159,44 +185,45 @@ private:
      * @brief 字符串转地支枚举
      */
     static DiZhi string_to_di_zhi(std::string_view str) {
-        static const std::unordered_map<std::string_view, DiZhi> map = {
-            {"子", DiZhi::Zi}, {"丑", DiZhi::Chou},
-            {"寅", DiZhi::Yin}, {"卯", DiZhi::Mao},
-            {"辰", DiZhi::Chen}, {"巳", DiZhi::Si},
-            {"午", DiZhi::Wu}, {"未", DiZhi::Wei},
-            {"申", DiZhi::Shen}, {"酉", DiZhi::You},
-            {"戌", DiZhi::Xu}, {"亥", DiZhi::Hai}
-        };
-        
-        if (auto it = map.find(str); it != map.end()) {
-            return it->second;
+        if (auto zhi = Mapper::from_zh_zhi(str)) {
+            return *zhi;
         }
         throw std::invalid_argument(std::string("无效的地支: ") + std::string(str));
     }
 };
 
+static_assert(sizeof(Pillar) == 2 && std::is_trivially_copyable_v<Pillar>);
+
+static_assert(Pillar::from_sixty_cycle_index(0).to_sixty_cycle_index() == 0);
+static_assert(Pillar::from_sixty_cycle_index(59).to_sixty_cycle_index() == 59);
+static_assert(Pillar(TianGan::Jia, DiZhi::Zi).get_xun_kong()[0] == DiZhi::Xu);
+static_assert(Pillar(TianGan::Gui, DiZhi::Hai).get_xun_kong()[1] == DiZhi::Zi);
+
 /**
  * @brief 四柱八字结构体
  * 
  * 表示一个完整的四柱八字信息（年月日时）
  */
 struct BaZi {
-    Pillar year;            // 年柱
-    Pillar month;           // 月柱
-    Pillar day;             // 日柱
-    Pillar hour;            // 时柱
-    std::string xun_kong_1; // 旬空地支1
-    std::string xun_kong_2; // 旬空地支2
-
-    // 默认构造函数
+    Pillar year;                        // 年柱
+    Pillar month;                       // 月柱
+    Pillar day;                         // 日柱
+    Pillar hour;                        // 时柱
+    DiZhi xun_kong_1 = DiZhi::Xu;       // 旬空地支1
+    DiZhi xun_kong_2 = DiZhi::Hai;      // 旬空地支2
+
+    // 默认构造函数（四柱甲子，旬空戌亥）
     BaZi() = default;
 
-    // 完整构造函数
-    BaZi(const Pillar& y, const Pillar& m, const Pillar& d, const Pillar& h,
-         const std::string& xk1 = "", const std::string& xk2 = "")
+    // 完整构造函数（旬空由日柱推出）
+    constexpr BaZi(const Pillar& y, const Pillar& m, const Pillar& d, const Pillar& h)
+        : year(y), month(m), day(d), hour(h),
+          xun_kong_1(d.get_xun_kong()[0]), xun_kong_2(d.get_xun_kong()[1]) {}
+
+    // 指定旬空的构造函数
+    constexpr BaZi(const Pillar& y, const Pillar& m, const Pillar& d, const Pillar& h, DiZhi xk1, DiZhi xk2)
         : year(y), month(m), day(d), hour(h), xun_kong_1(xk1), xun_kong_2(xk2) {}
 
-    // 比较运算符（注意：由于 std::string 在模块环境下的 <=> 问题，只提供 ==）
     bool operator==(const BaZi& other) const = default;
 
     /**
@@ -207,12 +234,12 @@ struct BaZi {
            << "月柱: " << bazi.month << "\n"
            << "日柱: " << bazi.day << "\n"
            << "时柱: " << bazi.hour << "\n"
-           << "旬空: " << bazi.xun_kong_1 << bazi.xun_kong_2;
+           << "旬空: " << Mapper::to_zh(bazi.xun_kong_1) << Mapper::to_zh(bazi.xun_kong_2);
         return os;
     }
 
     /**
-     * @brief JSON 序列化支持
+     * @brief JSON 序列化支持（旬空仍以地支名称输出）
      */
     friend void to_json(nlohmann::json& j, const BaZi& b) {
         j = {
@@ -220,8 +247,8 @@ struct BaZi {
             {"month", b.month},
             {"day", b.day},
             {"hour", b.hour},
-            {"xun_kong_1", b.xun_kong_1},
-            {"xun_kong_2", b.xun_kong_2}
+            {"xun_kong_1", std::string(Mapper::to_zh(b.xun_kong_1))},
+            {"xun_kong_2", std::string(Mapper::to_zh(b.xun_kong_2))}
         };
     }
 
@@ -233,10 +260,14 @@ struct BaZi {
         b.month = j["month"];
         b.day = j["day"];
         b.hour = j["hour"];
-        std::string xk1 = j["xun_kong_1"];
-        std::string xk2 = j["xun_kong_2"];
-        b.xun_kong_1 = xk1;
-        b.xun_kong_2 = xk2;
+        auto parse_xun_kong = [](const std::string& name) {
+            if (auto zhi = Mapper::from_zh_zhi(name)) {
+                return *zhi;
+            }
+            throw std::invalid_argument(std::string("无效的旬空地支: ") + name);
+        };
+        b.xun_kong_1 = parse_xun_kong(j["xun_kong_1"].get<std::string>());
+        b.xun_kong_2 = parse_xun_kong(j["xun_kong_2"].get<std::string>());
     }
 
     /**
@@ -257,30 +288,9 @@ struct BaZi {
         // 创建公历时间
         auto solar_time = tyme::SolarTime::from_ymd_hms(year, month, day, hour, minute, second);
         
-        // 获取农历时间
-        auto lunar_hour = solar_time.get_lunar_hour();
-        
-        // 获取八字
-        auto eight_char = lunar_hour.get_eight_char();
-        
-        // 获取各柱
-        auto year_cycle = eight_char.get_year();
-        auto month_cycle = eight_char.get_month();
-        auto day_cycle = eight_char.get_day();
-        auto hour_cycle = eight_char.get_hour();
-        
-        // 转换为 Pillar
-        Pillar year_pillar = convert_sixty_cycle_to_pillar(year_cycle);
-        Pillar month_pillar = convert_sixty_cycle_to_pillar(month_cycle);
-        Pillar day_pillar = convert_sixty_cycle_to_pillar(day_cycle);
-        Pillar hour_pillar = convert_sixty_cycle_to_pillar(hour_cycle);
-        
-        // 计算旬空（基于日柱）
-        auto xun_kong_branches = day_cycle.get_extra_earth_branches();
-        std::string xk1 = xun_kong_branches.size() > 0 ? xun_kong_branches[0].get_name() : "";
-        std::string xk2 = xun_kong_branches.size() > 1 ? xun_kong_branches[1].get_name() : "";
-        
-        return BaZi(year_pillar, month_pillar, day_pillar, hour_pillar, xk1, xk2);
+        // 获取农历时间与八字
+        auto eight_char = solar_time.get_lunar_hour().get_eight_char();
+        return from_eight_char(eight_char);
     }
 
     /**
@@ -298,49 +308,31 @@ struct BaZi {
      * auto bazi = BaZi::from_lunar(2024, 1, 1, 0);  // 农历2024年正月初一子时
      */
     static BaZi from_lunar(int year, int month, int day, int hour, int minute = 0, int second = 0) {
-        // 创建农历时间
-        auto lunar_hour = tyme::LunarHour::from_ymd_hms(year, month, day, hour, minute, second);
-        
-        // 获取八字
-        auto eight_char = lunar_hour.get_eight_char();
-        
-        // 获取各柱
-        auto year_cycle = eight_char.get_year();
-        auto month_cycle = eight_char.get_month();
-        auto day_cycle = eight_char.get_day();
-        auto hour_cycle = eight_char.get_hour();
-        
-        // 转换为 Pillar
-        Pillar year_pillar = convert_sixty_cycle_to_pillar(year_cycle);
-        Pillar month_pillar = convert_sixty_cycle_to_pillar(month_cycle);
-        Pillar day_pillar = convert_sixty_cycle_to_pillar(day_cycle);
-        Pillar hour_pillar = convert_sixty_cycle_to_pillar(hour_cycle);
-        
-        // 计算旬空（基于日柱）
-        auto xun_kong_branches = day_cycle.get_extra_earth_branches();
-        std::string xk1 = xun_kong_branches.size() > 0 ? xun_kong_branches[0].get_name() : "";
-        std::string xk2 = xun_kong_branches.size() > 1 ? xun_kong_branches[1].get_name() : "";
-        
-        return BaZi(year_pillar, month_pillar, day_pillar, hour_pillar, xk1, xk2);
+        // 创建农历时间并获取八字
+        auto eight_char = tyme::LunarHour::from_ymd_hms(year, month, day, hour, minute, second).get_eight_char();
+        return from_eight_char(eight_char);
     }
 
 private:
     /**
-     * @brief 将 tyme::SixtyCycle 转换为 Pillar
-     * 
-     * @param cycle 六十甲子对象
-     * @return Pillar 干支柱对象
+     * @brief 将 tyme::EightChar 转换为 BaZi
+     *
+     * 各柱按六十甲子序号换算，旬空由日柱序号推出，不经过名称字符串。
      */
-    static Pillar convert_sixty_cycle_to_pillar(const tyme::SixtyCycle& cycle) {
-        // 获取天干地支的名称
-        std::string gan_name = cycle.get_heaven_stem().get_name();
-        std::string zhi_name = cycle.get_earth_branch().get_name();
-        
-        // 通过字符串构造 Pillar（会使用 Pillar 的字符串构造函数）
-        return Pillar(gan_name, zhi_name);
+    static BaZi from_eight_char(const tyme::EightChar& eight_char) {
+        return BaZi(
+            Pillar::from_sixty_cycle(eight_char.get_year()),
+            Pillar::from_sixty_cycle(eight_char.get_month()),
+            Pillar::from_sixty_cycle(eight_char.get_day()),
+            Pillar::from_sixty_cycle(eight_char.get_hour())
+        );
     }
 };
 
+// 四柱各 2 字节、旬空各 1 字节：可按值传递、memcpy 及整块存入数组
+static_assert(std::is_trivially_copyable_v<BaZi>);
+static_assert(sizeof(BaZi) == 10);
+
 /**
  * @brief 公历日期结构体
  * 
@@ -417,8 +409,8 @@ struct fmt::formatter<ZhouYi::BaZiBase::BaZi> : fmt::formatter<std::string> {
             b.month.to_string(),
             b.day.to_string(),
             b.hour.to_string(),
-            b.xun_kong_1,
-            b.xun_kong_2
+            Mapper::to_zh(b.xun_kong_1),
+            Mapper::to_zh(b.xun_kong_2)
         );
         return fmt::formatter<std::string>::format(result, ctx);
     }
@@ -0,0 +1,188 @@
+// C++23 - 四柱批量换算内核实现
+module;
+
+#if defined(ZHOUYI_BAZI_AVX2)
+#include <immintrin.h>
+#endif
+
+module ZhouYi.BaZiBase.Kernel;
+
+import fmt;
+import ZhouYi.tyme;
+import std;
+
+namespace ZhouYi::BaZiBase {
+
+namespace {
+
+constexpr std::int64_t SECONDS_PER_DAY = 86400;
+
+/**
+ * @brief 时柱序号表：[日柱序号 × 24 + 钟点]
+ *
+ * 日柱序号须已按 23 时换日调整；时支为 (钟点 + 1) / 2，时干按“甲己还加甲”由日干推出。
+ */
+constexpr std::array<std::uint8_t, 60 * 24> HOUR_CYCLE = [] {
+    std::array<std::uint8_t, 60 * 24> table{};
+    for (int day = 0; day < 60; ++day) {
+        for (int hour = 0; hour < 24; ++hour) {
+            int zhi = (hour + 1) / 2 % 12;
+            int gan = (day % 10 % 5 * 2 + zhi) % 10;
+            table[day * 24 + hour] = static_cast<std::uint8_t>(((6 * gan - 5 * zhi) % 60 + 60) % 60);
+        }
+    }
+    return table;
+}();
+
+/**
+ * @brief 单个时刻的日柱、时柱（标量路径）
+ */
+inline void day_hour_cycle(std::int64_t seconds, SiZhuIndex& out) {
+    std::int64_t days = seconds / SECONDS_PER_DAY;
+    std::int64_t rest = seconds % SECONDS_PER_DAY;
+    if (rest < 0) {
+        --days;
+        rest += SECONDS_PER_DAY;
+    }
+    const int hour = static_cast<int>(rest / 3600);
+    // 23 时起算次日
+    int day = static_cast<int>(((days + DAY_CYCLE_OFFSET + (hour >= 23 ? 1 : 0)) % 60 + 60) % 60);
+    out.day = static_cast<std::uint8_t>(day);
+    out.hour = HOUR_CYCLE[day * 24 + hour];
+}
+
+#if defined(ZHOUYI_BAZI_AVX2) && defined(__AVX2__)
+/**
+ * @brief 4 个时刻的日柱、时柱（AVX2 路径）
+ *
+ * 以双精度做整除：|秒数| < 2^51 时整数到双精度的换算、商的取整与余数都是精确的，
+ * 结果与标量路径逐位一致。
+ */
+inline void day_hour_cycle_x4(const std::int64_t* seconds, SiZhuIndex* out) {
+    // 1.5 × 2^52：整数加上其位模式后按双精度解读，再减去它即得原值
+    const __m256d magic = _mm256_set1_pd(6755399441055744.0);
+    const __m256i raw = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(seconds));
+    const __m256d t = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_add_epi64(raw, _mm256_castpd_si256(magic))), magic);
+
+    const __m256d day_seconds = _mm256_set1_pd(static_cast<double>(SECONDS_PER_DAY));
+    const __m256d days = _mm256_floor_pd(_mm256_div_pd(t, day_seconds));
+    const __m256d rest = _mm256_sub_pd(t, _mm256_mul_pd(days, day_seconds));
+    const __m256d hour = _mm256_floor_pd(_mm256_div_pd(rest, _mm256_set1_pd(3600.0)));
+
+    // 23 时起算次日，再取模 60
+    const __m256d late = _mm256_and_pd(_mm256_cmp_pd(hour, _mm256_set1_pd(23.0), _CMP_GE_OQ), _mm256_set1_pd(1.0));
+    const __m256d shifted = _mm256_add_pd(_mm256_add_pd(days, _mm256_set1_pd(DAY_CYCLE_OFFSET)), late);
+    const __m256d sixty = _mm256_set1_pd(60.0);
+    const __m256d day = _mm256_sub_pd(shifted, _mm256_mul_pd(_mm256_floor_pd(_mm256_div_pd(shifted, sixty)), sixty));
+
+    alignas(16) std::int32_t day_index[4];
+    alignas(16) std::int32_t hour_index[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(day_index), _mm256_cvttpd_epi32(day));
+    _mm_store_si128(reinterpret_cast<__m128i*>(hour_index), _mm256_cvttpd_epi32(hour));
+    for (int lane = 0; lane < 4; ++lane) {
+        out[lane].day = static_cast<std::uint8_t>(day_index[lane]);
+        out[lane].hour = HOUR_CYCLE[day_index[lane] * 24 + hour_index[lane]];
+    }
+}
+#endif
+
+/**
+ * @brief 批量求日柱、时柱
+ */
+void day_hour_cycles(std::span<const std::int64_t> seconds, std::span<SiZhuIndex> out) {
+    std::size_t i = 0;
+#if defined(ZHOUYI_BAZI_AVX2) && defined(__AVX2__)
+    for (; i + 4 <= seconds.size(); i += 4) {
+        day_hour_cycle_x4(seconds.data() + i, out.data() + i);
+    }
+#endif
+    for (; i < seconds.size(); ++i) {
+        day_hour_cycle(seconds[i], out[i]);
+    }
+}
+
+[[noreturn]] void throw_out_of_range(const JieQiTable& table, std::int64_t seconds) {
+    throw std::out_of_range(fmt::format("时间 {} 超出节气表范围（{}～{}年）",
+                                        seconds, table.get_start_year(), table.get_end_year()));
+}
+
+} // namespace
+
+bool si_zhu_kernel_simd() {
+#if defined(ZHOUYI_BAZI_AVX2) && defined(__AVX2__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+JieQiTable JieQiTable::build(int start_year, int end_year) {
+    if (start_year < 1583 || end_year > 9998 || start_year > end_year) {
+        throw std::invalid_argument(fmt::format("无效的节气表年份范围: {}～{}", start_year, end_year));
+    }
+
+    JieQiTable table;
+    table.start_year_ = start_year;
+    table.end_year_ = end_year;
+    table.begin_ = to_civil_seconds(start_year, 1, 1);
+    table.end_ = to_civil_seconds(end_year + 1, 1, 1);
+
+    // 从前一年的大雪开始，保证覆盖 start_year 元旦
+    table.first_ordinal_ = (start_year - 1) * 12 + 11;
+    table.boundaries_.reserve(static_cast<std::size_t>(end_year - start_year + 1) * 12 + 1);
+    for (int year = start_year - 1; year <= end_year; ++year) {
+        // tyme 节气序号：奇数为节，1 小寒 …… 23 大雪
+        for (int index = year < start_year ? 23 : 1; index <= 23; index += 2) {
+            auto time = tyme::SolarTerm::from_index(year, index).get_julian_day().get_solar_time();
+            table.boundaries_.push_back(to_civil_seconds(time.get_year(), time.get_month(), time.get_day(),
+                                                         time.get_hour(), time.get_minute(), time.get_second()));
+        }
+    }
+    return table;
+}
+
+int JieQiTable::get_month_ordinal(std::int64_t seconds) const {
+    if (!contains(seconds)) {
+        throw_out_of_range(*this, seconds);
+    }
+    // 最后一个不晚于该时刻的节
+    auto it = std::ranges::upper_bound(boundaries_, seconds);
+    return first_ordinal_ + static_cast<int>(it - boundaries_.begin()) - 1;
+}
+
+void compute_si_zhu(std::span<const std::int64_t> seconds, const JieQiTable& table, std::span<SiZhuIndex> out) {
+    if (out.size() != seconds.size()) {
+        throw std::invalid_argument(fmt::format(
+            "四柱输出长度 {} 与时间戳个数 {} 不符", out.size(), seconds.size()));
+    }
+
+    day_hour_cycles(seconds, out);
+
+    // 年柱、月柱：先试上一个时间戳所在的节月区间，不中再二分
+    const auto boundaries = table.get_boundaries();
+    std::size_t k = 0;
+    for (std::size_t i = 0; i < seconds.size(); ++i) {
+        const std::int64_t t = seconds[i];
+        if (!table.contains(t)) {
+            throw_out_of_range(table, t);
+        }
+        if (t < boundaries[k] || (k + 1 < boundaries.size() && t >= boundaries[k + 1])) {
+            if (k + 2 < boundaries.size() && t >= boundaries[k + 1] && t < boundaries[k + 2]) {
+                ++k;
+            } else {
+                k = static_cast<std::size_t>(std::ranges::upper_bound(boundaries, t) - boundaries.begin()) - 1;
+            }
+        }
+        const int ordinal = table.get_first_ordinal() + static_cast<int>(k);
+        out[i].year = static_cast<std::uint8_t>(JieQiTable::year_cycle_of(ordinal));
+        out[i].month = static_cast<std::uint8_t>(JieQiTable::month_cycle_of(ordinal));
+    }
+}
+
+SiZhuIndex compute_si_zhu(std::int64_t seconds, const JieQiTable& table) {
+    SiZhuIndex result{};
+    compute_si_zhu(std::span<const std::int64_t>(&seconds, 1), table, std::span<SiZhuIndex>(&result, 1));
+    return result;
+}
+
+} // namespace ZhouYi::BaZiBase
@@ -0,0 +1,165 @@
+// C++23 Module - 四柱批量换算内核
+// 由时间戳与节气分界表直接求四柱六十甲子序号，不经过 tyme 对象
+export module ZhouYi.BaZiBase.Kernel;
+
+// 导入八字基础数据结构
+import ZhouYi.BaZiBase;
+
+// 导入标准库模块（最后）
+import std;
+
+/**
+ * @brief 四柱批量换算内核
+ *
+ * 日柱、时柱只是民用日序号与钟点的模运算；年柱、月柱只取决于时刻落在哪两个“节”之间
+ * （立春、惊蛰……小寒共十二节）。本内核预先排好节的时刻表，对每个时间戳：
+ * - 日、时：整除与查表，可按 4 路 AVX2 批量计算（编译选项 ZHOUYI_BAZI_AVX2）
+ * - 年、月：在节表中定位（先试上一个时间戳所在的区间，不中再二分）
+ *
+ * 结果与 BaZi::from_solar（tyme 默认八字流派：23 时起换日柱）逐柱一致。
+ */
+export namespace ZhouYi::BaZiBase {
+
+/**
+ * @brief 公历日期到 1970-01-01 的天数（格里历外推）
+ */
+constexpr std::int64_t days_from_civil(int year, int month, int day) {
+    year -= month <= 2;
+    const std::int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const int year_of_era = static_cast<int>(year - era * 400);
+    const int day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const int day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + day_of_era - 719468;
+}
+
+/**
+ * @brief 民用时间秒数：以 1970-01-01 00:00:00 为 0
+ *
+ * 与 tyme 使用同一时间尺度（即输入的钟表时间，不做时区换算）。
+ */
+constexpr std::int64_t to_civil_seconds(int year, int month, int day,
+                                        int hour = 0, int minute = 0, int second = 0) {
+    return days_from_civil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second;
+}
+
+/**
+ * @brief 日柱六十甲子序号：(1970-01-01 起的天数 + 17) mod 60
+ */
+constexpr int DAY_CYCLE_OFFSET = 17;
+
+static_assert((days_from_civil(1949, 10, 1) + DAY_CYCLE_OFFSET) % 60 == 0);   // 1949-10-01 甲子日
+
+/**
+ * @brief 四柱的六十甲子序号（0 为甲子）
+ */
+struct SiZhuIndex {
+    std::uint8_t year;
+    std::uint8_t month;
+    std::uint8_t day;
+    std::uint8_t hour;
+
+    bool operator==(const SiZhuIndex&) const = default;
+
+    /**
+     * @brief 转为八字（旬空由日柱推出）
+     */
+    constexpr BaZi to_ba_zi() const {
+        return BaZi(Pillar::from_sixty_cycle_index(year), Pillar::from_sixty_cycle_index(month),
+                    Pillar::from_sixty_cycle_index(day), Pillar::from_sixty_cycle_index(hour));
+    }
+};
+
+/**
+ * @brief 节气分界表
+ *
+ * 按时间顺序保存 [start_year, end_year] 各年十二节的时刻（民用秒数，精确到秒，
+ * 与 tyme 比较节气时的取整一致），另含 start_year 前一年的大雪。
+ * 第 k 个分界的节月序号为 first_ordinal + k，序号 = 年 × 12 + 节序（小寒 0、立春 1 …… 大雪 11）。
+ */
+class JieQiTable {
+public:
+    /**
+     * @brief 用 tyme 计算节气时刻，构建分界表（只在构建时使用 tyme）
+     *
+     * @throws std::invalid_argument 年份范围无效（须在 1583～9998 之间，格里历）
+     */
+    static JieQiTable build(int start_year, int end_year);
+
+    int get_start_year() const {
+        return start_year_;
+    }
+
+    int get_end_year() const {
+        return end_year_;
+    }
+
+    /**
+     * @brief 各节时刻（升序）
+     */
+    std::span<const std::int64_t> get_boundaries() const {
+        return boundaries_;
+    }
+
+    /**
+     * @brief 第一个分界的节月序号
+     */
+    int get_first_ordinal() const {
+        return first_ordinal_;
+    }
+
+    /**
+     * @brief 时刻是否在表的覆盖范围内（start_year 元旦至 end_year 除夕末）
+     */
+    bool contains(std::int64_t seconds) const {
+        return seconds >= begin_ && seconds < end_;
+    }
+
+    /**
+     * @brief 时刻所在的节月序号（二分查找）
+     *
+     * @throws std::out_of_range 超出表的覆盖范围
+     */
+    int get_month_ordinal(std::int64_t seconds) const;
+
+    /**
+     * @brief 节月序号对应的年柱、月柱序号（年柱以立春为界；序号须为正，即公元后）
+     */
+    static constexpr int year_cycle_of(int ordinal) {
+        return ((ordinal - 1) / 12 - 4) % 60;
+    }
+
+    static constexpr int month_cycle_of(int ordinal) {
+        return (ordinal + 13) % 60;
+    }
+
+private:
+    int start_year_ = 0;
+    int end_year_ = 0;
+    int first_ordinal_ = 0;
+    std::int64_t begin_ = 0;
+    std::int64_t end_ = 0;
+    std::vector<std::int64_t> boundaries_;
+};
+
+/**
+ * @brief 日柱、时柱是否使用 AVX2 路径（编译选项 ZHOUYI_BAZI_AVX2）；两条路径结果逐位一致
+ */
+bool si_zhu_kernel_simd();
+
+/**
+ * @brief 批量求四柱
+ *
+ * @param seconds 民用秒数（见 to_civil_seconds），可乱序；按时间排序时节表定位几乎都命中上一区间
+ * @param table 节气分界表，须覆盖所有时间戳
+ * @param out 输出，长度须与 seconds 相同
+ * @throws std::invalid_argument out 长度不符
+ * @throws std::out_of_range 时间戳超出节气表范围
+ */
+void compute_si_zhu(std::span<const std::int64_t> seconds, const JieQiTable& table, std::span<SiZhuIndex> out);
+
+/**
+ * @brief 单个时刻的四柱
+ */
+SiZhuIndex compute_si_zhu(std::int64_t seconds, const JieQiTable& table);
+
+} // namespace ZhouYi::BaZiBase
@@ -21,7 +21,7 @@ export namespace ZhouYi::GanZhi {
 /**
  * @brief 天干枚举
  */
-enum class TianGan {
+enum class TianGan : std::uint8_t {
     Jia = 0,   // 甲
     Yi,        // 乙
     Bing,      // 丙
@@ -37,7 +37,7 @@ enum class TianGan {
 /**
  * @brief 地支枚举
  */
-enum class DiZhi {
+enum class DiZhi : std::uint8_t {
     Zi = 0,    // 子
     Chou,      // 丑
     Yin,       // 寅
@@ -31,16 +31,16 @@ namespace tyme {
     }
 
     int LoopTyme::get_size() const {
-        return static_cast<int>(names.size());
+        return static_cast<int>(names->size());
     }
 
     string LoopTyme::get_name() const {
-        return names[index];
+        return (*names)[index];
     }
 
     int LoopTyme::index_of(const string &name) const {
         for (int i = 0, j = get_size(); i < j; i++) {
-            if (name == names[i]) {
+            if (name == (*names)[i]) {
                 return i;
             }
         }
@@ -1826,7 +1826,58 @@ namespace tyme {
         return EightChar(get_year(), get_month(), get_day(), get_sixty_cycle());
     }
 
-    vector<vector<int>> LunarYear::LEAP = vector<vector<int>>();
+    namespace {
+        /**
+         * @brief 闰月数据，第i个字符串对应闰(i+1)月，每2个字符(64进制，高位在前)为与上一个闰年的年数差
+         */
+        constexpr string_view LEAP_DATA[] = {
+            "080b0r0j0j0j0C0j0j0C0j0j0j0C0j0C0j0C0F0j0V0V0V0u0j0j0C0j0j0j0j0V0C0j1v0u0C0V1v0C0b080u110u0C0j0C1v9K1v2z0j1vmZbl1veN3s1v0V0C2S1v0V0C2S2o0C0j1Z1c2S1v0j1c0j2z1v0j1c0j392H0b2_2S0C0V0j1c0j2z0C0C0j0j1c0j0N250j0C0j0b081n080b0C0C0C1c0j0N",
+            "0r1v1c1v0V0V0F0V0j0C0j0C0j0V0j0u1O0j0C0V0j0j0j0V0b080u0r0u080b0j0j0C0V0C0V0j0b080V0u080b0j0j0u0j1v0u080b1c0j080b0j0V0j0j0V0C0N1v0j1c0j0j1v2g1v420j1c0j2z1v0j1v5Q9z1v4l0j1vfn1v420j9z4l1v1v2S1c0j1v2S3s1v0V0C2S1v1v2S1c0j1v2S2_0b0j2_2z0j1c0j",
+            "0z0j0j0j0C0j0j0C0j0j0j0C0j0C0j0j0j0j0m0j0C0j0j0C0j0j0j0j0b0V0j0j0C0j0j0j0j0V0j0j0j0V0b0V0V0C0V0C0j0j0b080u110u0V0C0j0N0j0b080b080b0j0r0b0r0b0j0j0j0j0C0j0b0r0C0j0b0j0C0C0j0j0j0j0j0j0j0j0j0b110j0b0j0j0j0C0j0C0j0j0j0j0b080b080b0V080b080b0j0j0j0j0j0j0V0j0j0u1v0j0j0j0C0j0j0j0V0C0N1c0j0C0C0j0j0j1n080b0j0V0C0j0C0C2g0j1c0j0j1v2g1v0j0j1v7N0j1c0j3L0j0j1v5Q1Z5Q1v4lfn1v420j1v5Q1Z5Q1v4l1v2z1v",
+            "0H140r0N0r140r0u0r0V171c11140C0j0u110j0u0j1v0j0C0j0j0j0b080V0u080b0C1v0j0j0j0C0j0b080V0j0j0b080b0j0j0j0j0b080b0C080j0b080b0j0j0j0j0j0j0b080j0b080C0b080b080b080b0j0j0j0j080b0j0C0j0j0j0b0j0j080C0b0j0j0j0j0j0j0b08080b0j0C0j0j0j0b0j0j0K0b0j0C0j0j0j0b080b080j0C0b0j080b080b0j0j0j0j080b0j0b0r0j0j0j0b0j0C0r0b0j0j0j0j0j0j0j0b080j0b0r0C0j0b0j0j0j0r0b0j0C0j0j0j0u0r0b0C0j080b0j0j0j0j0j0j0j1c0j0b0j0j0j0C0j0j0j0j0j0j0j0b080j1c0u0j0j0j0C0j1c0j0u0j1c0j0j0j0j0j0j0j0j1c0j0u1v0j0j0V0j0j2g0j0j0j0C1v0C1G0j0j0V0C1Z1O0j0V0j0j2g1v0j0j0V0C2g5x1v4l1v421O7N0V0C4l1v2S1c0j1v2S2_",
+            "050b080C0j0j0j0C0j0j0C0j0j0j0C0j0C0j0C030j0j0j0j0j0j0j0j0j0C0j0b080u0V080b0j0j0V0j0j0j0j0j0j0j0j0j0V0N0j0C0C0j0j0j0j0j0j0j0j1c0j0u0j1v0j0j0j0j0j0b080b080j0j0j0b080b080b080b080b0j0j0j080b0j0b080j0j0j0j0b080b0j0j0r0b080b0b080j0j0j0j0b080b080j0b080j0b080b080b080b080b0j0j0r0b0j0b080j0j0j0j0b080b0j0j0C080b0b080j0j0j0j0j0j0j0b080u080j0j0b0j0j0j0C0j0b080j0j0j0j0b080b080b080b0C080b080b080b0j0j0j0j0j0j0b0C080j0j0b0j0j0j0C0j0b080j0j0C0b080b080j0b0j0j0C080b0j0j0j0j0j0j0b0j0j080C0b0j080b0j0j0j0j0j0j0j0C0j0j0j0b0j0j0C080b0j0j0j0j0j0j0b080b080b0K0b080b080b0j0j0j0j0j0j0j0C0j0j0u0j0j0V0j080b0j0C0j0j0j0b0j0r0C0b0j0j0j0j0j0j0j0j0j0C0j0b080b080b0j0C0C0j0C0j0j0j0u110u0j0j0j0j0j0j0j0j0C0j0j0u0j1c0j0j0j0j0j0j0j0j0V0C0u0j0C0C0V0C1Z0j0j0j0C0j0j0j1v0u0j1c0j0j0j0C0j0j2g0j1c1v0C1Z0V0j4l0j0V0j0j2g0j1v0j1v2S1c7N1v",
+            "0w0j1c0j0V0j0j0V0V0V0j0m0V0j0C1c140j0j0j0C0V0C0j1v0j0N0j0C0j0j0j0V0j0j1v0N0j0j0V0j0j0j0j0j0j080b0j0j0j0j0j0j0j080b0j0C0j0j0j0b0j0j080u080b0j0j0j0j0j0j0b080b080b080C0b0j080b080b0j0j0j0j080b0j0C0j0j0j0b0j0j080u080b0j0j0j0j0j0j0b080b080b080b0r0b0j080b080b0j0j0j0j080b0j0b0r0j0j0b080b0j0j080b0j080b0j080b080b0j0j0j0j0j0b080b0r0C0b080b0j0j0j0j080b0b080b080j0j0j0b080b080b080b0j0j0j0j080b0j0b080j0j0j0j0b080b0j0j0r0b080b0j0j0j0j0j0b080b080j0b0r0b080j0b080b0j0j0j0j080b0j0b080j0j0j0j0b080b0j080b0r0b0j080b080b0j0j0j0j0j0b080b0r0C0b080b0j0j0j0j0j0j0b080j0j0j0b080b080b080b0j0j0j0r0b0j0b080j0j0j0j0b080b0r0b0r0b0j080b080b0j0j0j0j0j0j0b0r0j0j0j0b0j0j0j0j080b0j0b080j0j0j0j0b080b080b0j0r0b0j080b0j0j0j0j0j0j0j0b0r0C0b0j0j0j0j0j0j0j080b0j0C0j0j0j0b0j0C0r0b0j0j0j0j0j0j0b080b080u0r0b0j080b0j0j0j0j0j0j0j0b0r0C0u0j0j0j0C0j080b0j0C0j0j0j0u110b0j0j0j0j0j0j0j0j0j0C0j0b080b0j0j0C0C0j0C0j0j0j0b0j1c0j080b0j0j0j0j0j0j0V0j0j0u0j1c0j0j0j0C0j0j2g0j0j0j0C0j0j0V0j0b080b1c0C0V0j0j2g0j0j0V0j0j1c0j1Z0j0j0C0C0j1v",
+            "160j0j0V0j1c0j0C0j0C0j1f0j0V0C0j0j0C0j0j0j1G080b080u0V080b0j0j0V0j1v0j0u0j1c0j0j0j0C0j0j0j0C0C0j1D0b0j080b0j0j0j0j0C0j0b0r0C0j0b0j0C0C0j0j0j0j0j0j0j0j0j0b0r0b0r0j0b0j0j0j0C0j0b0r0j0j0j0b080b080j0b0C0j080b080b0j0j0j0j0j0j0b0C080j0j0b0j0j0j0C0j0b080j0j0j0j0b080b080j0b0C0r0j0b0j0j0j0j0j0j0b0C080j0j0b0j0j0j0C0j0j0j0j0C0j0j0b080b0j0j0C080b0j0j0j0j0j0j0b080b080b080C0b080b080b080b0j0j0j0j0j0b080C0j0j0b080b0j0j0C080b0j0j0j0j0j0j0b080j0b0C080j0j0b0j0j0j0j0j0j0b080j0b080C0b080b080b080b0j0j0j0j080b0j0C0j0j0b080b0j0j0C080b0j0j0j0j0j0j0b080j0b080u080j0j0b0j0j0j0j0j0j0b080C0j0j0b080b0j0j0C0j0j080b0j0j0j0j0j0b080b0C0r0b080b0j0j0j0j0j0j0b080j0b080u080b080b080b0j0j0j0C0j0b080j0j0j0j0b0j0j0j0C0j0j080b0j0j0j0j0j0b080b0C0r0b080b0j0j0j0j0j0j0b080j0b0r0b080b080b080b0j0j0j0r0b0j0b0r0j0j0j0b0j0j0j0r0b0j080b0j0j0j0j0j0j0j0b0r0C0b0j0j0j0j0j0j0j0b080j0C0u080b080b0j0j0j0r0b0j0C0C0j0b0j110b0j080b0j0j0j0j0j0j0u0r0C0b0j0j0j0j0j0j0j0j0j0C0j0j0j0b0j1c0j0C0j0j0j0b0j0814080b080b0j0j0j0j0j0j1c0j0u0j0j0V0j0j0j0j0j0j0j0u110u0j0j0j",
+            "020b0r0C0j0j0j0C0j0j0V0j0j0j0j0j0C0j1f0j0C0j0V1G0j0j0j0j0V0C0j0C1v0u0j0j0j0V0j0j0C0j0j0j1v0N0C0V0j0j0j0K0C250b0C0V0j0j0V0j0j2g0C0V0j0j0C0j0j0b081v0N0j0j0V0V0j0j0u0j1c0j080b0j0j0j0j0j0j0V0j0j0u0j0j0V0j0j0j0C0j0b080b080V0b0j080b0j0j0j0j0j0j0j0b0r0C0j0b0j0j0j0C0j080b0j0j0j0j0j0j0u0r0C0u0j0j0j0j0j0j0b080j0C0j0b080b080b0j0C0j080b0j0j0j0j0j0j0b080b110b0j0j0j0j0j0j0j0j0j0b0r0j0j0j0b0j0j0j0r0b0j0b080j0j0j0j0b080b080b080b0r0b0j080b080b0j0j0j0j0j0j0b0r0C0b080b0j0j0j0j080b0j0b080j0j0j0j0b080b080b0j0j0j0r0b0j0j0j0j0j0j0b080b0j080C0b0j080b080b0j0j0j0j080b0j0b0r0C0b080b0j0j0j0j080b0j0j0j0j0j0b080b080b080b0j0j080b0r0b0j0j0j0j0j0j0b0j0j080C0b0j080b080b0j0j0j0j0j0b080C0j0j0b080b0j0j0C0j0b080j0j0j0j0b080b080b080b0C0C080b0j0j0j0j0j0j0b0C0C080b080b080b0j0j0j0j0j0j0b0C080j0j0b0j0j0j0C0j0b080j0b080j0j0b080b080b080b0C0r0b0j0j0j0j0j0j0b080b0r0b0r0b0j080b080b0j0j0j0j0j0j0b0r0C0j0b0j0j0j0j0j0j0b080j0C0j0b080j0b0j0j0K0b0j0C0j0j0j0b080b0j0K0b0j080b0j0j0j0j0j0j0V0j0j0b0j0j0j0C0j0j0j0j",
+            "0l0C0K0N0r0N0j0r1G0V0m0j0V1c0C0j0j0j0j1O0N110u0j0j0j0C0j0j0V0C0j0u110u0j0j0j0C0j0j0j0C0C0j250j1c2S1v1v0j5x2g0j1c0j0j1c2z0j1c0j0j1c0j0N1v0V0C1v0C0b0C0V0j0j0C0j0C1v0u0j0C0C0j0j0j0C0j0j0j0u110u0j0j0j0C0j0C0C0C0b080b0j0C0j080b0j0C0j0j0j0u110u0j0j0j0C0j0j0j0C0j0j0j0u0C0r0u0j0j0j0j0j0j0b0r0b0V080b080b0j0C0j0j0j0V0j0j0b0j0j0j0C0j0j0j0j0j0j0j0b080j0b0C0r0j0b0j0j0j0C0j0b0r0b0r0j0b080b080b0j0C0j0j0j0j0j0j0j0j0b0j0C0r0b0j0j0j0j0j0j0b080b080j0b0r0b0r0j0b0j0j0j0j080b0j0b0r0j0j0j0b080b080b0j0j0j0j080b0j0j0j0j0j0j0b0j0j0j0r0b0j0j0j0j0j0j0b080b080b080b0r0C0b080b0j0j0j0j0j0b080b0r0C0b080b080b080b0j0j0j0j080b0j0C0j0j0j0b0j0j0C080b0j0j0j0j0j0j0b080j0b0C080j0j0b0j0j0j0j0j0j0b0r0b080j0j0b080b080b0j0j0j0j0j0j0b080j0j0j0j0b0j0j0j0r0b0j0b080j0j0j0j0j0b080b080b0C0r0b0j0j0j0j0j0j0b080b080j0C0b0j080b080b0j0j0j0j0j0j",
+            "0a0j0j0j0j0C0j0j0C0j0C0C0j0j0j0j0j0j0j0m0C0j0j0j0j0u080j0j0j1n0j0j0j0j0C0j0j0j0V0j0j0j1c0u0j0C0V0j0j0V0j0j1v0N0C0V2o1v1O2S2o141v0j1v4l0j1c0j1v2S2o0C0u1v0j0C0C2S1v0j1c0j0j1v0N251c0j1v0b1c1v1n1v0j0j0V0j0j1v0N1v0C0V0j0j1v0b0C0j0j0V1c0j0u0j1c0j0j0j0j0j0j0j0j1c0j0u0j0j0V0j0j0j0j0j0j0b080u110u0j0j0j0j0j0j1c0j0b0j080b0j0C0j0j0j0V0j0j0u0C0V0j0j0j0C0j0b080j1c0j0b0j0j0j0C0j0C0j0j0j0b080b080b0j0C0j080b0j0j0j0j0j0j0j0b0C0r0u0j0j0j0j0j0j0b080j0b0r0C0j0b0j0j0j0r0b0j0b0r0j0j0j0b080b080b0j0r0b0j080b0j0j0j0j0j0j0b0j0r0C0b0j0j0j0j0j0j0b080j0j0C0j0j0b080b0j0j0j0j0j0j0j0j0j0j0b080b080b080b0C0j0j080b0j0j0j0j0j0j0b0j0j0C080b0j0j0j0j0j0j0j0j0b0C080j0j0b0j0j0j0j0j",
+            "0n0Q0j1c14010q0V1c171k0u0r140V0j0j1c0C0N1O0j0V0j0j0j1c0j0u110u0C0j0C0V0C0j0j0b671v0j1v5Q1O2S2o2S1v4l1v0j1v2S2o0C1Z0j0C0C1O141v0j1c0j2z1O0j0V0j0j1v0b2H390j1c0j0V0C2z0j1c0j1v2g0C0V0j1O0b0j0j0V0C1c0j0u0j1c0j0j0j0j0j0j0j0j1c0N0j0j0V0j0j0C0j0j0b081v0u0j0j0j0C0j1c0N0j0j0C0j0j0j0C0j0j0j0u0C0r0u0j0j0j0C0j0b080j1c0j0b0j0C0C0j0C0C0j0b080b080u0C0j080b0j0C0j0j0j0u110u0j0j0j0j0j0j0j0j0C0C0j0b0j0j0j0C0j0C0C0j0b080b080b0j0C0j080b0j0C0j0j0j0b0j110b0j0j0j0j0j",
+            "0B0j0V0j0j0C0j0j0j0C0j0C0j0j0C0j0m0j0j0j0j0C0j0C0j0j0u0j1c0j0j0C0C0j0j0j0j0j0j0j0j0u110N0j0j0V0C0V0j0b081n080b0CrU1O5e2SbX2_1Z0V2o141v0j0C0C0j2z1v0j1c0j7N1O420j1c0j1v2S1c0j1v2S2_0b0j0V0j0j1v0N1v0j0j1c0j1v140j0V0j0j0C0C0b080u1v0C0V0u110u0j0j0j0C0j0j0j0C0C0N0C0V0j0j0C0j0j0b080u110u0C0j0C0u0r0C0u080b0j0j0C0j0j0j"
+        };
+
+        constexpr int decode_leap_char(const char c) {
+            if (c >= '0' && c <= '9') {
+                return c - '0';
+            }
+            if (c >= 'a' && c <= 'z') {
+                return c - 'a' + 10;
+            }
+            if (c >= 'A' && c <= 'Z') {
+                return c - 'A' + 36;
+            }
+            return '_' == c ? 62 : 63;
+        }
+
+        constexpr array<int8_t, 10001> decode_leap_months() {
+            array<int8_t, 10001> months{};
+            for (int i = 0; i < 12; i++) {
+                const string_view m = LEAP_DATA[i];
+                int year = 0;
+                for (size_t j = 0; j + 1 < m.length(); j += 2) {
+                    year += decode_leap_char(m[j]) * 64 + decode_leap_char(m[j + 1]);
+                    if (year >= -1 && year <= 9999 && months[year + 1] == 0) {
+                        months[year + 1] = static_cast<int8_t>(i + 1);
+                    }
+                }
+            }
+            // 公元前1年闰11月
+            months[0] = 11;
+            return months;
+        }
+    }
+
+    constinit const array<int8_t, 10001> LunarYear::LEAP_MONTHS = decode_leap_months();
+
 
     LunarYear LunarYear::from_year(const int year) {
         return LunarYear(year);
@@ -1882,15 +1933,7 @@ namespace tyme {
     }
 
     int LunarYear::get_leap_month() const {
-        if (year == -1) {
-            return 11;
-        }
-        for (int i = 0; i < 12; i++) {
-            if (vector<int> l = LEAP[i]; find(l.begin(), l.end(), year) != l.end()) {
-                return i + 1;
-            }
-        }
-        return 0;
+        return LEAP_MONTHS[year + 1];
     }
 
     KitchenGodSteed LunarYear::get_kitchen_god_steed() const {
@@ -1925,6 +1968,58 @@ namespace tyme {
         return from_index(next_index(n));
     }
 
+    const uint32_t LunarTable::DATA[] = {
+        0x003f16d2, 0x00620752, 0x004c0ea5, 0x0038b64a, 0x005c064b, 0x00460a9b, 0x00309556, 0x0056056a,
+        0x00400b59, 0x002c5752, 0x00500752, 0x003adb25, 0x00600b25, 0x004a0a4b, 0x0032b4ab, 0x005802ad,
+        0x0042056b, 0x002e4b69, 0x00520da9, 0x003efd92, 0x00640e92, 0x004e0d25, 0x0036ba4d, 0x005c0a56,
+        0x004602b6, 0x003095b5, 0x005606d4, 0x00400ea9, 0x002c5e92, 0x00520e92, 0x003acd26, 0x005e052b,
+        0x00480a57, 0x0034b2b6, 0x00580b5a, 0x004406d4, 0x002e6ec9, 0x00540749, 0x003ef693, 0x00620a93,
+        0x004c052b, 0x0036ca5b, 0x005c0aad, 0x0046056a, 0x00309b55, 0x00580ba4, 0x00420b49, 0x002a5a93,
+        0x00500a95, 0x003af52d, 0x00600536, 0x00480aad, 0x0034b5aa, 0x005a05b2, 0x00440da5, 0x002e7d4a,
+        0x00540d4a, 0x003f0a95, 0x00620a97, 0x004c0556, 0x0036cab5, 0x005c0ad5, 0x004806d2, 0x00308ea5,
+        0x00560ea5, 0x0042064a, 0x002a6c97, 0x004e0a9b, 0x003af55a, 0x0060056a, 0x004a0b69, 0x0036b752,
+        0x005a0b52, 0x00440b25, 0x002e964b, 0x00540a4b, 0x003d14ab, 0x006202ad, 0x004c056d, 0x0038cb69,
+        0x005c0da9, 0x00480d92, 0x00329d25, 0x00580d25, 0x00415a4d, 0x00660a56, 0x005002b6, 0x003ac5b5,
+        0x005e06d5, 0x004a0ea9, 0x0036be92, 0x005c0e92, 0x00440d26, 0x002e6a56, 0x00520a57, 0x003f14d6,
+        0x0062035a, 0x004c06d5, 0x0038b6c9, 0x005e0749, 0x00460693, 0x0030952b, 0x0056052b, 0x00400a5b,
+        0x002c555a, 0x0050056a, 0x003afb55, 0x00620ba4, 0x004c0b49, 0x0034ba93, 0x005a0a95, 0x0044052d,
+        0x002e8aad, 0x00520ab5, 0x003f35aa, 0x006405d2, 0x004e0da5, 0x0038dd4a, 0x005e0d4a, 0x00480c95,
+        0x0032952e, 0x00560556, 0x00400ab5, 0x002c55b2, 0x005206d2, 0x003acea5, 0x00600725, 0x004a064b,
+        0x0034ac97, 0x00580cab, 0x0044055a, 0x002e6ad6, 0x00540b69, 0x00417752, 0x00640b52, 0x004e0b25,
+        0x0038da4b, 0x005e0a4b, 0x004604ab, 0x0030a55b, 0x005605ad, 0x00420b6a, 0x002c5b52, 0x00520d92,
+        0x003cfd25, 0x00620d25, 0x004a0a55, 0x0034b4ad, 0x005a04b6, 0x004405b5, 0x002e6daa, 0x00540ec9,
+        0x00411e92, 0x00660e92, 0x004e0d26, 0x0038ca56, 0x005c0a57, 0x00480556, 0x003086d5, 0x00560755,
+        0x00420749, 0x002c6e93, 0x00500693, 0x003af52b, 0x0060052b, 0x004a0a5b, 0x0036b55a, 0x005a056a,
+        0x00440b65, 0x0030974a, 0x00560b4a, 0x003f1a95, 0x00640a95, 0x004e052d, 0x0038caad, 0x005c0ab5,
+        0x004805aa, 0x00328ba5, 0x00580da5, 0x00420d4a, 0x002c7c95, 0x00520c96, 0x003cf94e, 0x00600556,
+        0x004a0ab5, 0x0036b5b2, 0x005c06d2, 0x00440ea5, 0x00308e4a, 0x0054068b, 0x003f0c97, 0x006204ab,
+        0x004c055b, 0x0038cad6, 0x005e0b6a, 0x00480752, 0x00329725, 0x00580b45, 0x00420a8b, 0x002c549b,
+        0x005004ab
+    };
+
+    bool LunarTable::contains(const int year) {
+        return year >= MIN_YEAR && year <= MAX_YEAR;
+    }
+
+    int LunarTable::get_leap_month(const int year) {
+        return static_cast<int>(DATA[year - MIN_YEAR] >> 13 & 0xF);
+    }
+
+    int LunarTable::get_first_day(const int year, const int index) {
+        const uint32_t data = DATA[year - MIN_YEAR];
+        const int first_day = static_cast<int>(floor((year - 2000) * 365.2422)) + static_cast<int>(data >> 17 & 0x3F);
+        return first_day + 29 * index + popcount(data & ((1u << index) - 1));
+    }
+
+    int LunarTable::get_day_count(const int year, const int index) {
+        return 29 + static_cast<int>(DATA[year - MIN_YEAR] >> index & 1);
+    }
+
+    uint32_t LunarTable::encode(const int year, const int first_day, const int leap_month, const uint32_t big_months) {
+        const int offset = first_day - static_cast<int>(floor((year - 2000) * 365.2422));
+        return (big_months & 0x1FFF) | static_cast<uint32_t>(leap_month) << 13 | static_cast<uint32_t>(offset) << 17;
+    }
+
     const vector<string> LunarMonth::NAMES = {"正月", "二月", "三月", "四月", "五月", "六月", "七月", "八月", "九月", "十月", "十一月", "十二月"};
 
     LunarMonth LunarMonth::from_ym(const int year, const int month) {
@@ -2451,7 +2546,11 @@ namespace tyme {
     }
 
     EightChar LunarHour::get_eight_char() const {
-        return provider->get_eight_char(*this);
+        return get_eight_char(*provider);
+    }
+
+    EightChar LunarHour::get_eight_char(const EightCharProvider &provider) const {
+        return provider.get_eight_char(*this);
     }
 
     EightCharProvider* LunarHour::provider = new DefaultEightCharProvider();
@@ -2460,15 +2559,70 @@ namespace tyme {
         "冬至", "小寒", "大寒", "立春", "雨水", "惊蛰", "春分", "清明", "谷雨", "立夏", "小满", "芒种", "夏至", "小暑", "大暑", "立秋", "处暑", "白露", "秋分", "寒露", "霜降", "立冬", "小雪", "大雪"
     };
 
-    void SolarTerm::init_by_year(const int year, const int offset) {
+    atomic<uint64_t> SolarTermCache::cursory[SolarTermCache::SIZE] = {};
+
+    atomic<uint64_t> SolarTermCache::accurate[SolarTermCache::SIZE] = {};
+
+    atomic<uint64_t> SolarTermCache::hits = 0;
+
+    atomic<uint64_t> SolarTermCache::misses = 0;
+
+    double SolarTermCache::calc_cursory_julian_day(const int year, const int index) {
         const double jd = floor((year - 2000) * 365.2422 + 180);
         // 355是2000.12冬至，得到较靠近jd的冬至估计值
         double w = floor((jd - 355 + 183) / 365.2422) * 365.2422 + 355;
         if (ShouXingUtil::calc_qi(w) > jd) {
             w -= 365.2422;
         }
+        return ShouXingUtil::calc_qi(w + 15.2184 * index);
+    }
+
+    double SolarTermCache::get(atomic<uint64_t> *values, const int year, const int index, double (*calc)(int, int)) {
+        if (year < MIN_YEAR || year > MAX_YEAR) {
+            misses.fetch_add(1, memory_order_relaxed);
+            return calc(year, index);
+        }
+        atomic<uint64_t> &slot = values[(year - MIN_YEAR) * 24 + index];
+        if (const uint64_t bits = slot.load(memory_order_relaxed); bits != 0) {
+            hits.fetch_add(1, memory_order_relaxed);
+            return bit_cast<double>(bits);
+        }
+        misses.fetch_add(1, memory_order_relaxed);
+        const double v = calc(year, index);
+        slot.store(bit_cast<uint64_t>(v), memory_order_relaxed);
+        return v;
+    }
+
+    double SolarTermCache::get_cursory_julian_day(const int year, const int index) {
+        return get(cursory, year, index, calc_cursory_julian_day);
+    }
+
+    double SolarTermCache::get_julian_day(const int year, const int index) {
+        return get(accurate, year, index, [](const int y, const int i) {
+            return ShouXingUtil::qi_accurate2(get_cursory_julian_day(y, i));
+        });
+    }
+
+    uint64_t SolarTermCache::get_hits() {
+        return hits.load(memory_order_relaxed);
+    }
+
+    uint64_t SolarTermCache::get_misses() {
+        return misses.load(memory_order_relaxed);
+    }
+
+    void SolarTermCache::clear() {
+        for (int i = 0; i < SIZE; i++) {
+            cursory[i].store(0, memory_order_relaxed);
+            accurate[i].store(0, memory_order_relaxed);
+        }
+        hits.store(0, memory_order_relaxed);
+        misses.store(0, memory_order_relaxed);
+    }
+
+    void SolarTerm::init_by_year(const int year, const int offset) {
         this->year = year;
-        cursory_julian_day = ShouXingUtil::calc_qi(w + 15.2184 * offset);
+        cursory_julian_day = SolarTermCache::get_cursory_julian_day(year, offset);
     }
 
     SolarTerm SolarTerm::from_index(const int year, const int index) {
@@ -2494,7 +2648,7 @@ namespace tyme {
     }
 
     JulianDay SolarTerm::get_julian_day() const {
-        return JulianDay::from_julian_day(ShouXingUtil::qi_accurate2(cursory_julian_day) + JulianDay::J2000);
+        return JulianDay::from_julian_day(SolarTermCache::get_julian_day(year, index) + JulianDay::J2000);
     }
 
     int SolarTerm::get_year() const {
@@ -3363,66 +3517,91 @@ namespace tyme {
     }
 
     vector<SolarTime> EightChar::get_solar_times(const int start_year, const int end_year) const {
+        return get_solar_times(start_year, end_year, false);
+    }
+
+    vector<SolarTime> EightChar::get_solar_times(const int start_year, const int end_year, const bool parallel) const {
         auto l = vector<SolarTime>();
         // 月地支距寅月的偏移值
-        int m = month.get_earth_branch().next(-2).get_index();
+        const int m = month.get_earth_branch().next(-2).get_index();
         // 月天干要一致
         if (!HeavenStem::from_index((year.get_heaven_stem().get_index() + 1) * 2 + m).equals(month.get_heaven_stem())) {
             return l;
         }
         // 1年的立春是辛酉，序号57
         int y = year.next(-57).get_index() + 1;
-        // 节令偏移值
-        m *= 2;
-        // 时辰地支转时刻
-        const int h = hour.get_earth_branch().get_index() * 2;
-        // 兼容子时多流派
-        auto hours = vector<int>();
-        hours.push_back(h);
-        if (h == 0) {
-            hours.push_back(23);
-        }
         if (const int base_year = start_year - 1; base_year > y) {
             y += 60 * static_cast<int>(ceil((base_year - y) / 60.0));
         }
-        while (y <= end_year) {
-            // 立春为寅月的开始
-            SolarTerm term = SolarTerm::from_index(y, 3);
-            // 节令推移，年干支和月干支就都匹配上了
-            if (m > 0) {
-                term = term.next(m);
+        // 年干支每60年重复一次
+        auto years = vector<int>();
+        for (; y <= end_year; y += 60) {
+            years.push_back(y);
+        }
+        const size_t n = parallel ? min<size_t>(years.size(), max(1u, thread::hardware_concurrency())) : 1;
+        if (n < 2) {
+            for (const int candidate_year: years) {
+                collect_solar_times(candidate_year, start_year, l);
             }
-            if (SolarTime solar_time = term.get_julian_day().get_solar_time(); solar_time.get_year() >= start_year) {
-                // 日干支和节令干支的偏移值
-                SolarDay solar_day = solar_time.get_solar_day();
-                int d = day.next(-solar_day.get_lunar_day().get_sixty_cycle().get_index()).get_index();
-                if (d > 0) {
-                    // 从节令推移天数
-                    solar_day = solar_day.next(d);
-                }
-                for (const int hour: hours) {
-                    int mi = 0;
-                    int s = 0;
-                    // 如果正好是节令当天，且小时和节令的小时数相等的极端情况，把分钟和秒钟带上
-                    if (d == 0 && hour == solar_time.get_hour()) {
-                        mi = solar_time.get_minute();
-                        s = solar_time.get_second();
-                    }
-                    SolarTime time = SolarTime::from_ymd_hms(solar_day.get_year(), solar_day.get_month(), solar_day.get_day(), hour, mi, s);
-                    if (d == 30) {
-                        time = time.next(-3600);
-                    }
-                    // 验证一下
-                    if (time.get_lunar_hour().get_eight_char().equals(this)) {
-                        l.push_back(time);
-                    }
+            return l;
+        }
+        // 按年段切分，各段结果依次拼接即保持升序
+        auto futures = vector<future<vector<SolarTime>>>();
+        for (size_t i = 0; i < n; i++) {
+            futures.push_back(async(launch::async, [this, &years, start_year, from = i * years.size() / n, to = (i + 1) * years.size() / n] {
+                auto times = vector<SolarTime>();
+                for (size_t j = from; j < to; j++) {
+                    collect_solar_times(years[j], start_year, times);
                 }
-            }
-            y += 60;
+                return times;
+            }));
+        }
+        for (auto &f: futures) {
+            const vector<SolarTime> times = f.get();
+            l.insert(l.end(), times.begin(), times.end());
         }
         return l;
     }
 
+    void EightChar::collect_solar_times(const int candidate_year, const int start_year, vector<SolarTime> &times) const {
+        // 节令偏移值，立春为寅月的开始，节令推移后年干支和月干支就都匹配上了
+        const int index = 3 + month.get_earth_branch().next(-2).get_index() * 2;
+        // 直接查节气缓存，不构造SolarTerm
+        const SolarTime solar_time = JulianDay::from_julian_day(SolarTermCache::get_julian_day(candidate_year + index / 24, index % 24) + JulianDay::J2000).get_solar_time();
+        if (solar_time.get_year() < start_year) {
+            return;
+        }
+        // 日干支和节令干支的偏移值，日干支索引为(儒略日数 - 11) % 60
+        SolarDay solar_day = solar_time.get_solar_day();
+        const int d = day.next(-((to_value(solar_day).day - 11) % 60)).get_index();
+        if (d > 0) {
+            // 从节令推移天数
+            solar_day = solar_day.next(d);
+        }
+        // 时辰地支转时刻
+        const int h = hour.get_earth_branch().get_index() * 2;
+        // 兼容子时多流派
+        const int hours[] = {h, 23};
+        for (int i = 0, n = h == 0 ? 2 : 1; i < n; i++) {
+            const int hour = hours[i];
+            int mi = 0;
+            int s = 0;
+            // 如果正好是节令当天，且小时和节令的小时数相等的极端情况，把分钟和秒钟带上
+            if (d == 0 && hour == solar_time.get_hour()) {
+                mi = solar_time.get_minute();
+                s = solar_time.get_second();
+            }
+            SolarTime time = SolarTime::from_ymd_hms(solar_day.get_year(), solar_day.get_month(), solar_day.get_day(), hour, mi, s);
+            if (d == 30) {
+                time = time.next(-3600);
+            }
+            // 验证一下（八字计算接口可替换，仍以其结果为准）
+            if (time.get_lunar_hour().get_eight_char().equals(this)) {
+                times.push_back(time);
+            }
+        }
+    }
+
     string EightChar::get_name() const {
         return year.to_string() + " " + month.to_string() + " " + day.to_string() + " " + hour.to_string();
     }
@@ -3473,7 +3652,15 @@ namespace tyme {
 
     ChildLimitProvider* ChildLimit::provider = new DefaultChildLimitProvider();
 
-    ChildLimitInfo ChildLimit::get_info(const SolarTime &birth_time, const bool forward) {
+    const EightCharProvider &ProviderContext::get_eight_char_provider() const {
+        return eight_char_provider ? *eight_char_provider : *LunarHour::provider;
+    }
+
+    const ChildLimitProvider &ProviderContext::get_child_limit_provider() const {
+        return child_limit_provider ? *child_limit_provider : *ChildLimit::provider;
+    }
+
+    ChildLimitInfo ChildLimit::get_info(const SolarTime &birth_time, const bool forward, const ChildLimitProvider &provider) {
         SolarTerm term = birth_time.get_term();
         if (!term.is_jie()) {
             term = term.next(-1);
@@ -3481,7 +3668,7 @@ namespace tyme {
         if (forward) {
             term = term.next(2);
         }
-        return provider->get_info(birth_time, term);
+        return provider.get_info(birth_time, term);
     }
 
     Fortune Fortune::from_child_limit(const ChildLimit& child_limit, const int index) {
@@ -3549,6 +3736,10 @@ namespace tyme {
         return ChildLimit(birth_time, gender);
     }
 
+    ChildLimit ChildLimit::from_solar_time(const SolarTime& birth_time, const Gender gender, const ProviderContext &context) {
+        return ChildLimit(birth_time, gender, context);
+    }
+
     EightChar ChildLimit::get_eight_char() const {
         return eight_char;
     }
@@ -3725,20 +3916,38 @@ namespace tyme {
 
     string LegalHoliday::DATA = "2001122900+032001123000+022002010110+002002010210-012002010310-022002020901+032002021001+022002021211+002002021311-012002021411-022002021511-032002021611-042002021711-052002021811-062002042703+042002042803+032002050113+002002050213-012002050313-022002050413-032002050513-042002050613-052002050713-062002092806+032002092906+022002100116+002002100216-012002100316-022002100416-032002100516-042002100616-052002100716-062003010110+002003020111+002003020211-012003020311-022003020411-032003020511-042003020611-052003020711-062003020801-072003020901-082003042603+052003042703+042003050113+002003050213-012003050313-022003050413-032003050513-042003050613-052003050713-062003092706+042003092806+032003100116+002003100216-012003100316-022003100416-032003100516-042003100616-052003100716-062004010110+002004011701+052004011801+042004012211+002004012311-012004012411-022004012511-032004012611-042004012711-052004012811-062004050113+002004050213-012004050313-022004050413-032004050513-042004050613-052004050713-062004050803-072004050903-082004100116+002004100216-012004100316-022004100416-032004100516-042004100616-052004100716-062004100906-082004101006-092005010110+002005010210-012005010310-022005020501+042005020601+032005020911+002005021011-012005021111-022005021211-032005021311-042005021411-052005021511-062005043003+012005050113+002005050213-012005050313-022005050413-032005050513-042005050613-052005050713-062005050803-072005100116+002005100216-012005100316-022005100416-032005100516-042005100616-052005100716-062005100806-072005100906-082005123100+012006010110+002006010210-012006010310-022006012801+012006012911+002006013011-012006013111-022006020111-032006020211-042006020311-052006020411-062006020501-072006042903+022006043003+012006050113+002006050213-012006050313-022006050413-032006050513-042006050613-052006050713-062006093006+012006100116+002006100216-012006100316-022006100416-032006100516-042006100616-052006100716-062006100806-072006123000+022006123100+012007010110+002007010210-012007010310-022007021701+012007021811+002007021911-012007022011-022007022111-032007022211-042007022311-052007022411-062007022501-072007042803+032007042903+022007050113+002007050213-012007050313-022007050413-032007050513-042007050613-052007050713-062007092906+022007093006+012007100116+002007100216-012007100316-022007100416-032007100516-042007100616-052007100716-062007122900+032007123010+022007123110+012008010110+002008020201+042008020301+032008020611+002008020711-012008020811-022008020911-032008021011-042008021111-052008021211-062008040412+002008040512-012008040612-022008050113+002008050213-012008050313-022008050403-032008060714+012008060814+002008060914-012008091315+012008091415+002008091515-012008092706+042008092806+032008092916+022008093016+012008100116+002008100216-012008100316-022008100416-032008100516-042009010110+002009010210-012009010310-022009010400-032009012401+012009012511+002009012611-012009012711-022009012811-032009012911-042009013011-052009013111-062009020101-072009040412+002009040512-012009040612-022009050113+002009050213-012009050313-022009052814+002009052914-012009053014-022009053104-032009092706+042009100116+002009100216-012009100316-022009100416-032009100515-022009100615-032009100715-042009100815-052009101005-072010010110+002010010210-012010010310-022010021311+002010021411-012010021511-022010021611-032010021711-042010021811-052010021911-062010022001-072010022101-082010040312+022010040412+012010040512+002010050113+002010050213-012010050313-022010061204+042010061304+032010061414+022010061514+012010061614+002010091905+032010092215+002010092315-012010092415-022010092505-032010092606+052010100116+002010100216-012010100316-022010100416-032010100516-042010100616-052010100716-062010100906-082011010110+002011010210-012011010310-022011013001+042011020211+012011020311+002011020411-012011020511-022011020611-032011020711-042011020811-052011021201-092011040202+032011040312+022011040412+012011040512+002011043013+012011050113+002011050213-012011060414+022011060514+012011060614+002011091015+022011091115+012011091215+002011100116+002011100216-012011100316-022011100416-032011100516-042011100616-052011100716-062011100806-072011100906-082011123100+012012010110+002012010210-012012010310-022012012101+022012012211+012012012311+002012012411-012012012511-022012012611-032012012711-042012012811-052012012901-062012033102+042012040102+032012040212+022012040312+012012040412+002012042803+032012042913+022012043013+012012050113+002012050203-012012062214+012012062314+002012062414-012012092905+012012093015+002012100116+002012100216-012012100316-022012100416-032012100516-042012100616-052012100716-062012100806-072013010110+002013010210-012013010310-022013010500-042013010600-052013020911+012013021011+002013021111-012013021211-022013021311-032013021411-042013021511-052013021601-062013021701-072013040412+002013040512-012013040612-022013042703+042013042803+032013042913+022013043013+012013050113+002013060804+042013060904+032013061014+022013061114+012013061214+002013091915+002013092015-012013092115-022013092205-032013092906+022013100116+002013100216-012013100316-022013100416-032013100516-042013100616-052013100716-062014010110+002014012601+052014013111+002014020111-012014020211-022014020311-032014020411-042014020511-052014020611-062014020801-082014040512+002014040612-012014040712-022014050113+002014050213-012014050313-022014050403-032014053114+022014060114+012014060214+002014090615+022014090715+012014090815+002014092806+032014100116+002014100216-012014100316-022014100416+002014100516-042014100616-052014100716-062014101106-102015010110+002015010210-012015010310-022015010400-032015021501+042015021811+012015021911+002015022011-012015022111-022015022211-032015022311-042015022411-052015022801-092015040412+012015040512+002015040612-012015050113+002015050213-012015050313-022015062014+002015062114-012015062214-022015090318+002015090418-012015090518-022015090608-032015092615+012015092715+002015100116+002015100216-012015100316-022015100416+002015100516-042015100616-052015100716-062015101006-092016010110+002016010210-012016010310-022016020601+022016020711+012016020811+002016020911-012016021011-022016021111-032016021211-042016021311-052016021401-062016040212+022016040312+012016040412+002016043013+012016050113+002016050213-012016060914+002016061014-012016061114-022016061204-032016091515+002016091615-012016091715-022016091805-032016100116+002016100216-012016100316-022016100416-032016100516-042016100616-052016100716-062016100806-072016100906-082016123110+012017010110+002017010210-012017012201+062017012711+012017012811+002017012911-012017013011-022017013111-032017020111-042017020211-052017020401-072017040102+032017040212+022017040312+012017040412+002017042913+022017043013+012017050113+002017052704+032017052814+022017052914+012017053014+002017093006+012017100116+002017100216-012017100316-022017100415+002017100516-042017100616-052017100716-062017100816-072017123010+022017123110+012018010110+002018021101+052018021511+012018021611+002018021711-012018021811-022018021911-032018022011-042018022111-052018022401-082018040512+002018040612-012018040712-022018040802-032018042803+032018042913+022018043013+012018050113+002018061614+022018061714+012018061814+002018092215+022018092315+012018092415+002018092906+022018093006+012018100116+002018100216-012018100316-022018100416-032018100516-042018100616-052018100716-062018122900+032018123010+022018123110+012019010110+002019020201+032019020301+022019020411+012019020511+002019020611-012019020711-022019020811-032019020911-042019021011-052019040512+002019040612-012019040712-022019042803+032019050113+002019050213-012019050313-022019050413-032019050503-042019060714+002019060814-012019060914-022019091315+002019091415-012019091515-022019092906+022019100116+002019100216-012019100316-022019100416-032019100516-042019100616-052019100716-062019101206-112020010110+002020011901+062020012411+012020012511+002020012611-012020012711-022020012811-032020012911-042020013011-052020013111-062020020111-072020020211-082020040412+002020040512-012020040612-022020042603+052020050113+002020050213-012020050313-022020050413-032020050513-042020050903-082020062514+002020062614-012020062714-022020062804-032020092707+042020100117+002020100216-012020100316-022020100416-032020100516-042020100616-052020100716-062020100816-072020101006-092021010110+002021010210-012021010310-022021020701+052021021111+012021021211+002021021311-012021021411-022021021511-032021021611-042021021711-052021022001-082021040312+012021040412+002021040512-012021042503+062021050113+002021050213-012021050313-022021050413-032021050513-042021050803-072021061214+022021061314+012021061414+002021091805+032021091915+022021092015+012021092115+002021092606+052021100116+002021100216-012021100316-022021100416-032021100516-042021100616-052021100716-062021100906-082022010110+002022010210-012022010310-022022012901+032022013001+022022013111+012022020111+002022020211-012022020311-022022020411-032022020511-042022020611-052022040202+032022040312+022022040412+012022040512+002022042403+072022043013+012022050113+002022050213-012022050313-022022050413-032022050703-062022060314+002022060414-012022060514-022022091015+002022091115-012022091215-022022100116+002022100216-012022100316-022022100416-032022100516-042022100616-052022100716-062022100806-072022100906-082022123110+012023010110+002023010210-012023012111+012023012211+002023012311-012023012411-022023012511-032023012611-042023012711-052023012801-062023012901-072023040512+002023042303+082023042913+022023043013+012023050113+002023050213-012023050313-022023050603-052023062214+002023062314-012023062414-022023062504-032023092915+002023093016+012023100116+002023100216-012023100316-022023100416-032023100516-042023100616-052023100706-062023100806-072023123010+022023123110+012024010110+002024020401+062024021011+002024021111-012024021211-022024021311-032024021411-042024021511-052024021611-062024021711-072024021801-082024040412+002024040512-012024040612-022024040702-032024042803+032024050113+002024050213-012024050313-022024050413-032024050513-042024051103-102024060814+022024060914+012024061014+002024091405+032024091515+022024091615+012024091715+002024092906+022024100116+002024100216-012024100316-022024100416-032024100516-042024100616-052024100716-062024101206-112025010110+002025012601+032025012811+012025012911+002025013011-012025013111-022025020111-032025020211-032025020311-042025020411-052025020801-092025040412+002025040512-012025040612-022025042703+042025050113+002025050213-012025050313-022025050413-032025050513-042025053114+002025060114-012025060214-022025092807+032025100117+002025100217-012025100317-022025100417-032025100517-042025100617-052025100717-062025100817-072025101107-10";
 
-    SolarDay LegalHoliday::compute_target(const string &data) const {
-        const int offset = stoi(data.substr(data.length()-2));
-        return day.next('-' == data[10] ? -offset : offset);
+    const vector<LegalHoliday::Record> &LegalHoliday::get_records() {
+        static const vector<Record> records = [] {
+            // 每条记录13个字符：yyyymmdd + 班休(0班1休) + 名称索引 + 偏移方向(+/-) + 2位偏移天数
+            constexpr size_t size = 13;
+            vector<Record> l;
+            l.reserve(DATA.length() / size);
+            for (size_t i = 0; i + size <= DATA.length(); i += size) {
+                const string data = DATA.substr(i, size);
+                l.push_back({stoi(data.substr(0, 8)), data[9] - '0', data[8] == '0', ('-' == data[10] ? -1 : 1) * stoi(data.substr(11))});
+            }
+            stable_sort(l.begin(), l.end(), [](const Record &a, const Record &b) {
+                return a.ymd < b.ymd;
+            });
+            return l;
+        }();
+        return records;
+    }
+
+    LegalHoliday LegalHoliday::from_record(const Record &record) {
+        return LegalHoliday(record.ymd / 10000, record.ymd / 100 % 100, record.ymd % 100, record.name_index, record.work, record.offset);
     }
 
     optional<LegalHoliday> LegalHoliday::from_ymd(const int year, const int month, const int day) {
-        char buffer[9];
-        snprintf(buffer, sizeof(buffer), "%04d%02d%02d", year, month, day);
-        const regex re(string(buffer) + "[0-1][0-8][\\+|-]\\d{2}");
-        if (smatch match; regex_search(DATA, match, re)) {
-            const string data= match[0];
-            return LegalHoliday(year, month, day, data);
+        const vector<Record> &records = get_records();
+        const int ymd = year * 10000 + month * 100 + day;
+        const auto it = lower_bound(records.begin(), records.end(), ymd, [](const Record &r, const int v) {
+            return r.ymd < v;
+        });
+        if (it == records.end() || it->ymd != ymd) {
+            return nullopt;
         }
-        return nullopt;
+        return from_record(*it);
     }
 
     SolarDay LegalHoliday::get_day() const {
@@ -3761,75 +3970,23 @@ namespace tyme {
         return day.to_string() + " " + name + "(" + (work ? "班" : "休") + ")";
     }
 
-    optional<LegalHoliday> LegalHoliday::next(int n) const {
-        int year = day.get_year();
-        int month = day.get_month();
+    optional<LegalHoliday> LegalHoliday::next(const int n) const {
         if (n == 0) {
-            return from_ymd(year, month, day.get_day()).value();
-        }
-        auto data = vector<string>();
-        char buffer[9];
-        snprintf(buffer, sizeof(buffer), "%04d%02d%02d", year, month, day.get_day());
-        auto today = string(buffer);
-        char buffer_y[5];
-        snprintf(buffer_y, sizeof(buffer_y), "%04d", year);
-        regex re(string(buffer_y) + R"(\d{4}[0-1][0-8][\+|-]\d{2})");
-        smatch match;
-        auto search_start(DATA.cbegin());
-        while (regex_search(search_start, DATA.cend(), match, re)) {
-            data.push_back(match[0]);
-            search_start = match[0].second;
-        }
-        int index = -1;
-        int size = static_cast<int>(data.size());
-        for (int i = 0; i < size; i++) {
-            if (equal(today.begin(), today.end(), data[i].begin())) {
-                index = i;
-                break;
-            }
-        }
-        if (index == -1) {
+            return from_ymd(day.get_year(), day.get_month(), day.get_day()).value();
+        }
+        const vector<Record> &records = get_records();
+        const int ymd = day.get_year() * 10000 + day.get_month() * 100 + day.get_day();
+        const auto it = lower_bound(records.begin(), records.end(), ymd, [](const Record &r, const int v) {
+            return r.ymd < v;
+        });
+        if (it == records.end() || it->ymd != ymd) {
             return nullopt;
         }
-        index += n;
-        int y = year;
-        if (n > 0) {
-            while (index >= size) {
-                index -= size;
-                y += 1;
-                data.clear();
-                snprintf(buffer_y, sizeof(buffer_y), "%04d", y);
-                regex r(string(buffer_y) + R"(\d{4}[0-1][0-8][\+|-]\d{2})");
-                auto start(DATA.cbegin());
-                while (regex_search(start, DATA.cend(), match, r)) {
-                    data.push_back(match[0]);
-                    start = match[0].second;
-                }
-                size = static_cast<int>(data.size());
-                if (size < 1) {
-                    return nullopt;
-                }
-            }
-        } else {
-            while (index < 0) {
-                y -= 1;
-                data.clear();
-                snprintf(buffer_y, sizeof(buffer_y), "%04d", y);
-                regex r(string(buffer_y) + R"(\d{4}[0-1][0-8][\+|-]\d{2})");
-                auto start(DATA.cbegin());
-                while (regex_search(start, DATA.cend(), match, r)) {
-                    data.push_back(match[0]);
-                    start = match[0].second;
-                }
-                size = static_cast<int>(data.size());
-                if (size < 1) {
-                    return nullopt;
-                }
-                index += size;
-            }
+        const auto index = (it - records.begin()) + n;
+        if (index < 0 || index >= static_cast<ptrdiff_t>(records.size())) {
+            return nullopt;
         }
-        string d = data[index];
-        return LegalHoliday(stoi(d.substr(0, 4)), stoi(d.substr(4, 2)), stoi(d.substr(6, 2)), d);
+        return from_record(records[index]);
     }
 
     const vector<string> SolarFestival::NAMES = {
@@ -3838,48 +3995,74 @@ namespace tyme {
 
     string SolarFestival::DATA = "@00001011950@01003081950@02003121979@03005011950@04005041950@05006011950@06007011941@07008011933@08009101985@09010011950";
 
+    const vector<SolarFestival::Record> &SolarFestival::get_records() {
+        static const vector<Record> records = [] {
+            // 每条记录：@ + 2位索引 + 类型 + 2位月 + 2位日 + 起始年
+            vector<Record> l(NAMES.size(), Record{0, 0, 0, 0, 0});
+            for (size_t i = DATA.find('@'); i != string::npos;) {
+                const size_t end = DATA.find('@', i + 1);
+                const string data = DATA.substr(i, end == string::npos ? string::npos : end - i);
+                if (const int index = stoi(data.substr(1, 2)); index < static_cast<int>(l.size()) && l[index].type == 0) {
+                    l[index] = {index, data[3], stoi(data.substr(4, 2)), stoi(data.substr(6, 2)), stoi(data.substr(8))};
+                }
+                i = end;
+            }
+            return l;
+        }();
+        return records;
+    }
+
+    const vector<pair<int, int>> &SolarFestival::get_day_index() {
+        static const vector<pair<int, int>> day_index = [] {
+            vector<pair<int, int>> l;
+            for (const Record &r: get_records()) {
+                if (r.type == '0') {
+                    l.emplace_back(r.month * 100 + r.day, r.index);
+                }
+            }
+            stable_sort(l.begin(), l.end(), [](const pair<int, int> &a, const pair<int, int> &b) {
+                return a.first < b.first;
+            });
+            return l;
+        }();
+        return day_index;
+    }
+
     optional<SolarFestival> SolarFestival::from_index(const int year, const int index) {
         if (index < 0 || static_cast<size_t>(index) >= NAMES.size()) {
             throw invalid_argument("illegal index: " + std::to_string(index));
         }
-        char buffer[3];
-        snprintf(buffer, sizeof(buffer), "%02d", index);
-        const regex re("@" + string(buffer) + "\\d+");
-        if (smatch match; regex_search(DATA, match, re)) {
-            FestivalType type;
-            const string data = match[0];
-            char d = data[3];
-            if ('0' == d) {
-                type = FestivalType::DAY;
-            } else if ('1' == d) {
-                type = FestivalType::TERM;
-            } else if ('2' == d) {
-                type = FestivalType::EVE;
-            } else {
-                return nullopt;
-            }
-            const int start_year = stoi(data.substr(8));
-            if (year < start_year) {
-                return nullopt;
-            }
-            return SolarFestival(type, SolarDay::from_ymd(year, stoi(data.substr(4, 2)), stoi(data.substr(6, 2))), start_year, data);
+        const Record &r = get_records()[index];
+        FestivalType type;
+        if ('0' == r.type) {
+            type = FestivalType::DAY;
+        } else if ('1' == r.type) {
+            type = FestivalType::TERM;
+        } else if ('2' == r.type) {
+            type = FestivalType::EVE;
+        } else {
+            return nullopt;
         }
-        return nullopt;
+        if (year < r.start_year) {
+            return nullopt;
+        }
+        return SolarFestival(type, SolarDay::from_ymd(year, r.month, r.day), r.start_year, index);
     }
 
     optional<SolarFestival> SolarFestival::from_ymd(const int year, const int month, const int day) {
-        char buffer[5];
-        snprintf(buffer, sizeof(buffer), "%02d%02d", month, day);
-        const regex re("@\\d{2}0" + string(buffer) + "\\d+");
-        if (smatch match; regex_search(DATA, match, re)) {
-            const string data= match[0];
-            const int start_year = stoi(data.substr(8));
-            if (year < start_year) {
-                return nullopt;
-            }
-            return SolarFestival(FestivalType::DAY, SolarDay::from_ymd(year, month, day), start_year, data);
+        const vector<pair<int, int>> &day_index = get_day_index();
+        const int md = month * 100 + day;
+        const auto it = lower_bound(day_index.begin(), day_index.end(), md, [](const pair<int, int> &p, const int v) {
+            return p.first < v;
+        });
+        if (it == day_index.end() || it->first != md) {
+            return nullopt;
         }
-        return nullopt;
+        const Record &r = get_records()[it->second];
+        if (year < r.start_year) {
+            return nullopt;
+        }
+        return SolarFestival(FestivalType::DAY, SolarDay::from_ymd(year, month, day), r.start_year, r.index);
     }
 
     optional<SolarFestival> SolarFestival::next(const int n) const {
@@ -3918,55 +4101,83 @@ namespace tyme {
 
     string LunarFestival::DATA = "@0000101@0100115@0200202@0300303@04107@0500505@0600707@0700715@0800815@0900909@10124@1101208@122";
 
+    const vector<LunarFestival::Record> &LunarFestival::get_records() {
+        static const vector<Record> records = [] {
+            // 每条记录：@ + 2位索引 + 类型 + (DAY: 2位月 + 2位日 | TERM: 节气索引 | EVE: 无)
+            vector<Record> l;
+            for (size_t i = DATA.find('@'); i != string::npos;) {
+                const size_t end = DATA.find('@', i + 1);
+                const string data = DATA.substr(i, end == string::npos ? string::npos : end - i);
+                Record r{stoi(data.substr(1, 2)), data[3], 0, 0};
+                if ('0' == r.type) {
+                    r.month = stoi(data.substr(4, 2));
+                    r.day = stoi(data.substr(6));
+                } else if ('1' == r.type) {
+                    r.month = stoi(data.substr(4));
+                }
+                l.push_back(r);
+                i = end;
+            }
+            return l;
+        }();
+        return records;
+    }
+
+    const LunarFestival::Record *LunarFestival::find_record(const int index) {
+        for (const Record &r: get_records()) {
+            if (r.index == index) {
+                return &r;
+            }
+        }
+        return nullptr;
+    }
+
     optional<LunarFestival> LunarFestival::from_index(const int year, const int index) {
         if (index < 0 || static_cast<size_t>(index) >= NAMES.size()) {
             throw invalid_argument("illegal index: " + std::to_string(index));
         }
-        char buffer[3];
-        snprintf(buffer, sizeof(buffer), "%02d", index);
-        const regex re("@" + string(buffer) + "\\d+");
-        if (smatch match; regex_search(DATA, match, re)) {
-            const string data= match[0];
-            const char d = data[3];
-            if ('0' == d) {
-                return LunarFestival(FestivalType::DAY, LunarDay::from_ymd(year, stoi(data.substr(4, 2)), stoi(data.substr(6))), nullopt, data);
-            }
-            if ('1' == d) {
-                SolarTerm solar_term = SolarTerm::from_index(year, stoi(data.substr(4)));
-                return LunarFestival(FestivalType::TERM, solar_term.get_julian_day().get_solar_day().get_lunar_day(), solar_term, data);
-            }
-            if ('2' == d) {
-                return LunarFestival(FestivalType::EVE, LunarDay::from_ymd(year + 1, 1, 1).next(-1), nullopt, data);
-            }
+        const Record *r = find_record(index);
+        if (!r) {
+            return nullopt;
+        }
+        if ('0' == r->type) {
+            return LunarFestival(FestivalType::DAY, LunarDay::from_ymd(year, r->month, r->day), nullopt, index);
+        }
+        if ('1' == r->type) {
+            SolarTerm solar_term = SolarTerm::from_index(year, r->month);
+            return LunarFestival(FestivalType::TERM, solar_term.get_julian_day().get_solar_day().get_lunar_day(), solar_term, index);
+        }
+        if ('2' == r->type) {
+            return LunarFestival(FestivalType::EVE, LunarDay::from_ymd(year + 1, 1, 1).next(-1), nullopt, index);
         }
         return nullopt;
     }
 
     optional<LunarFestival> LunarFestival::from_ymd(int year, int month, int day) {
-        char buffer[15];
-        snprintf(buffer, sizeof(buffer), "@\\d{2}0%02d%02d", month, day);
-        const string pattern = string(buffer);
-        const regex re(pattern);
-        smatch match;
-        if (regex_search(DATA, match, re)) {
-            const string data= match[0];
-            return LunarFestival(FestivalType::DAY, LunarDay::from_ymd(year, month, day), nullopt, data);
-        }
-        const regex re1("@\\d{2}1\\d{2}");
-        auto start(DATA.cbegin());
-        while (regex_search(start, DATA.cend(), match, re1)) {
-            const string data= match[0];
-            SolarTerm solar_term = SolarTerm::from_index(year, stoi(data.substr(4)));
+        const vector<Record> &records = get_records();
+        for (const Record &r: records) {
+            if ('0' == r.type && r.month == month && r.day == day) {
+                return LunarFestival(FestivalType::DAY, LunarDay::from_ymd(year, month, day), nullopt, r.index);
+            }
+        }
+        for (const Record &r: records) {
+            if ('1' != r.type) {
+                continue;
+            }
+            SolarTerm solar_term = SolarTerm::from_index(year, r.month);
             if (LunarDay lunar_day = solar_term.get_julian_day().get_solar_day().get_lunar_day(); lunar_day.get_year() == year && lunar_day.get_month() == month && lunar_day.get_day() == day) {
-                return LunarFestival(FestivalType::TERM, lunar_day, solar_term, data);
+                return LunarFestival(FestivalType::TERM, lunar_day, solar_term, r.index);
             }
-            start = match[0].second;
         }
-        if (const regex re2("@\\d{2}2"); regex_search(DATA, match, re2)) {
+        for (const Record &r: records) {
+            if ('2' != r.type) {
+                continue;
+            }
             LunarDay lunar_day = LunarDay::from_ymd(year, month, day);
             if (LunarDay next_day = lunar_day.next(1); next_day.get_month() == 1 && next_day.get_day() == 1) {
-                return LunarFestival(FestivalType::EVE, lunar_day, nullopt, match[0]);
+                return LunarFestival(FestivalType::EVE, lunar_day, nullopt, r.index);
             }
+            break;
         }
         return nullopt;
     }
@@ -4039,7 +4250,7 @@ namespace tyme {
     }
 
     string RabByungElement::get_name() const {
-        return regex_replace(names[index], regex("金"), "铁");
+        return regex_replace((*names)[index], regex("金"), "铁");
     }
 
     RabByungYear RabByungYear::from_sixty_cycle(const int rab_byung_index, const SixtyCycle& sixty_cycle) {
@@ -4389,4 +4600,207 @@ namespace tyme {
     RabByungDay RabByungDay::next(const int n) const {
         return get_solar_day().next(n).get_rab_byung_day();
     }
-}
\ No newline at end of file
+
+    size_t CalendarColumns::size() const {
+        return day_sixty_cycle.size();
+    }
+
+    void CalendarColumns::reserve(const size_t n) {
+        lunar_year.reserve(n);
+        lunar_month.reserve(n);
+        lunar_day.reserve(n);
+        lunar_leap.reserve(n);
+        year_sixty_cycle.reserve(n);
+        month_sixty_cycle.reserve(n);
+        day_sixty_cycle.reserve(n);
+        term.reserve(n);
+    }
+
+    void CalendarColumns::clear() {
+        lunar_year.clear();
+        lunar_month.clear();
+        lunar_day.clear();
+        lunar_leap.clear();
+        year_sixty_cycle.clear();
+        month_sixty_cycle.clear();
+        day_sixty_cycle.clear();
+        term.clear();
+    }
+
+    namespace {
+        /**
+         * @brief 公历日对应的儒略日数（正午）
+         */
+        int to_day(const SolarDay &d) {
+            return static_cast<int>(floor(d.get_julian_day().get_day() + 0.5));
+        }
+
+        int to_day(const SolarTerm &t) {
+            return to_day(t.get_julian_day().get_solar_day());
+        }
+
+        int8_t to_sixty_cycle_index(const int n) {
+            return static_cast<int8_t>((n % 60 + 60) % 60);
+        }
+    }
+
+    CalendarColumns CalendarBatch::convert(const JulianDay &start, const JulianDay &end) {
+        CalendarColumns columns;
+        convert(start, end, columns);
+        return columns;
+    }
+
+    void CalendarBatch::convert(const JulianDay &start, const JulianDay &end, CalendarColumns &columns) {
+        const SolarDay s = start.get_solar_day();
+        convert(s, end.get_solar_day().subtract(s), columns);
+    }
+
+    void CalendarBatch::convert(const SolarDay &start, const int n, CalendarColumns &columns) {
+        if (n <= 0) {
+            return;
+        }
+        columns.reserve(columns.size() + n);
+        const int first = to_day(start);
+
+        // 农历月：跨过下月初一时换月
+        const LunarDay lunar_day = start.get_lunar_day();
+        LunarMonth month = lunar_day.get_lunar_month();
+        int day = lunar_day.get_day();
+        int next_month_day = first - day + 1 + month.get_day_count();
+
+        // 节气：跨过下一节气时换节气
+        SolarTerm term = start.get_term();
+        int term_day = to_day(term);
+        int next_term_day = to_day(term.next(1));
+
+        // 公历年：干支年以立春为界，干支月以当年正月为基准
+        int solar_year = start.get_year();
+        int spring_day = to_day(SolarTerm::from_index(solar_year, 3));
+        int next_year_day = solar_year < 9999 ? to_day(SolarDay::from_ymd(solar_year + 1, 1, 1)) : numeric_limits<int>::max();
+
+        for (int d = first, last = first + n; d < last; d++, day++) {
+            if (d == next_year_day) {
+                solar_year++;
+                spring_day = to_day(SolarTerm::from_index(solar_year, 3));
+                next_year_day = solar_year < 9999 ? to_day(SolarDay::from_ymd(solar_year + 1, 1, 1)) : numeric_limits<int>::max();
+            }
+            if (d == next_month_day) {
+                month = month.next(1);
+                day = 1;
+                next_month_day += month.get_day_count();
+            }
+            if (d == next_term_day) {
+                term = term.next(1);
+                term_day = next_term_day;
+                next_term_day = to_day(term.next(1));
+            }
+
+            int index = term.get_index() - 3;
+            if (index < 0 && term_day > spring_day) {
+                index += 24;
+            }
+            const int cycle_year = d < spring_day ? solar_year - 1 : solar_year;
+
+            columns.lunar_year.push_back(month.get_year());
+            columns.lunar_month.push_back(static_cast<int8_t>(month.get_month()));
+            columns.lunar_day.push_back(static_cast<int8_t>(day));
+            columns.lunar_leap.push_back(month.is_leap() ? 1 : 0);
+            columns.year_sixty_cycle.push_back(to_sixty_cycle_index(cycle_year - 4));
+            // 当年正月（寅月）的干支索引为 year * 12 + 14
+            columns.month_sixty_cycle.push_back(to_sixty_cycle_index(solar_year * 12 + 14 + static_cast<int>(floor(index * 0.5))));
+            columns.day_sixty_cycle.push_back(to_sixty_cycle_index(d - 11));
+            columns.term.push_back(static_cast<int8_t>(term.get_index()));
+        }
+    }
+
+    SolarDayValue to_value(const SolarDay &solar_day) {
+        return SolarDayValue{to_day(solar_day)};
+    }
+
+    SolarTimeValue to_value(const SolarTime &solar_time) {
+        return SolarTimeValue{to_day(solar_time.get_solar_day()), solar_time.get_hour() * 3600 + solar_time.get_minute() * 60 + solar_time.get_second()};
+    }
+
+    LunarDayValue to_value(const LunarDay &lunar_day) {
+        return LunarDayValue{static_cast<int16_t>(lunar_day.get_year()), static_cast<int8_t>(lunar_day.get_month()), static_cast<int8_t>(lunar_day.get_day())};
+    }
+
+    LunarHourValue to_value(const LunarHour &lunar_hour) {
+        return LunarHourValue{to_value(lunar_hour.get_lunar_day()), lunar_hour.get_hour() * 3600 + lunar_hour.get_minute() * 60 + lunar_hour.get_second()};
+    }
+
+    SolarDay to_solar_day(const SolarDayValue value) {
+        return JulianDay::from_julian_day(value.day).get_solar_day();
+    }
+
+    SolarTime to_solar_time(const SolarTimeValue value) {
+        const SolarDay d = to_solar_day(SolarDayValue{value.day});
+        return SolarTime::from_ymd_hms(d.get_year(), d.get_month(), d.get_day(), value.second / 3600, value.second % 3600 / 60, value.second % 60);
+    }
+
+    LunarDay to_lunar_day(const LunarDayValue value) {
+        return LunarDay::from_ymd(value.year, value.month, value.day);
+    }
+
+    LunarHour to_lunar_hour(const LunarHourValue value) {
+        return LunarHour::from_ymd_hms(value.day.year, value.day.month, value.day.day, value.second / 3600, value.second % 3600 / 60, value.second % 60);
+    }
+
+    JulianDay to_julian_day(const SolarTimeValue value) {
+        return JulianDay::from_julian_day(value.day - 0.5 + value.second / 86400.0);
+    }
+
+    LunarDayValue to_lunar_day_value(const SolarDayValue value) {
+        const int d = value.day - static_cast<int>(JulianDay::J2000);
+        int year = static_cast<int>(floor(d / 365.2422)) + 2000;
+        if (LunarTable::contains(year) && d < LunarTable::get_first_day(year, 0)) {
+            year--;
+        }
+        if (LunarTable::contains(year) && d >= LunarTable::get_first_day(year, 0)) {
+            const int leap_month = LunarTable::get_leap_month(year);
+            int index = leap_month > 0 ? 12 : 11;
+            while (index > 0 && d < LunarTable::get_first_day(year, index)) {
+                index--;
+            }
+            const int offset = d - LunarTable::get_first_day(year, index);
+            if (offset < LunarTable::get_day_count(year, index)) {
+                int month = index + 1;
+                if (leap_month > 0 && index >= leap_month) {
+                    month = index == leap_month ? -leap_month : index;
+                }
+                return LunarDayValue{static_cast<int16_t>(year), static_cast<int8_t>(month), static_cast<int8_t>(offset + 1)};
+            }
+        }
+        const LunarDay lunar_day = to_solar_day(value).get_lunar_day();
+        const LunarMonth m = lunar_day.get_lunar_month();
+        return LunarDayValue{static_cast<int16_t>(m.get_year()), static_cast<int8_t>(m.get_month_with_leap()), static_cast<int8_t>(lunar_day.get_day())};
+    }
+
+    SolarDayValue to_solar_day_value(const LunarDayValue value) {
+        if (LunarTable::contains(value.year)) {
+            const int leap_month = LunarTable::get_leap_month(value.year);
+            const int month = value.month;
+            if (month > 0 ? month <= 12 : leap_month > 0 && -month == leap_month) {
+                int index = month - 1;
+                if (month < 0) {
+                    index = leap_month;
+                } else if (leap_month > 0 && month > leap_month) {
+                    index = month;
+                }
+                if (value.day >= 1 && value.day <= LunarTable::get_day_count(value.year, index)) {
+                    return SolarDayValue{static_cast<int>(JulianDay::J2000) + LunarTable::get_first_day(value.year, index) + value.day - 1};
+                }
+            }
+        }
+        // 超出表范围或数值非法（由LunarDay抛出异常）
+        return to_value(to_lunar_day(value).get_solar_day());
+    }
+
+    LunarHourValue to_lunar_hour_value(const SolarTimeValue value) {
+        return LunarHourValue{to_lunar_day_value(SolarDayValue{value.day}), value.second};
+    }
+
+    SolarTimeValue to_solar_time_value(const LunarHourValue value) {
+        return SolarTimeValue{to_solar_day_value(value.day).day, value.second};
+    }
+}
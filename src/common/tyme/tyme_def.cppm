@@ -119,32 +119,23 @@ export namespace tyme {
 
         /**
          * @brief 通过索引初始化
-         * @param names 名称列表
+         * @param names 名称列表，须为静态常量表（如各子类的NAMES），仅保存其地址
          * @param index 索引，支持负数，自动轮转
          */
-        LoopTyme(const vector<string> &names, const int index) : names(names), index(index_of(index)) {
+        LoopTyme(const vector<string> &names, const int index) : names(&names), index(index_of(index)) {
         }
 
         /**
          * @brief 通过名称初始化
-         * @param names 名称列表
+         * @param names 名称列表，须为静态常量表（如各子类的NAMES），仅保存其地址
          * @param name 名称
          */
-        LoopTyme(const vector<string> &names, const string &name) : names(names), index(index_of(name)) {
+        LoopTyme(const vector<string> &names, const string &name) : names(&names), index(index_of(name)) {
         }
 
-        LoopTyme(const LoopTyme &other) {
-            names = other.names;
-            index = other.get_index();
-        }
+        LoopTyme(const LoopTyme &other) = default;
 
-        LoopTyme& operator=(const LoopTyme &other) {
-            if (this != &other) {
-                names = other.names;
-                index = other.get_index();
-            }
-            return *this;
-        }
+        LoopTyme& operator=(const LoopTyme &other) = default;
 
         /**
          * @brief 索引
@@ -194,9 +185,9 @@ export namespace tyme {
 
     protected:
         /**
-         * @brief 名称列表
+         * @brief 名称列表（指向共享的静态名称表，复制时不再拷贝字符串）
          */
-        vector<string> names;
+        const vector<string> *names;
 
         /**
          * @brief 索引，从0开始
@@ -1903,44 +1894,12 @@ export namespace tyme {
     public:
         ~LunarYear() override = default;
 
-        static vector<vector<int> > LEAP;
+        /**
+         * @brief 闰月表，下标为年+1（-1至9999年），值为闰月，0代表无闰月
+         */
+        static const array<int8_t, 10001> LEAP_MONTHS;
 
         explicit LunarYear(const int year) : AbstractCulture() {
-            static once_flag flag;
-            call_once(flag, [] {
-                string chars = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_@";
-                string months[] = {
-                    "080b0r0j0j0j0C0j0j0C0j0j0j0C0j0C0j0C0F0j0V0V0V0u0j0j0C0j0j0j0j0V0C0j1v0u0C0V1v0C0b080u110u0C0j0C1v9K1v2z0j1vmZbl1veN3s1v0V0C2S1v0V0C2S2o0C0j1Z1c2S1v0j1c0j2z1v0j1c0j392H0b2_2S0C0V0j1c0j2z0C0C0j0j1c0j0N250j0C0j0b081n080b0C0C0C1c0j0N",
-                    "0r1v1c1v0V0V0F0V0j0C0j0C0j0V0j0u1O0j0C0V0j0j0j0V0b080u0r0u080b0j0j0C0V0C0V0j0b080V0u080b0j0j0u0j1v0u080b1c0j080b0j0V0j0j0V0C0N1v0j1c0j0j1v2g1v420j1c0j2z1v0j1v5Q9z1v4l0j1vfn1v420j9z4l1v1v2S1c0j1v2S3s1v0V0C2S1v1v2S1c0j1v2S2_0b0j2_2z0j1c0j",
-                    "0z0j0j0j0C0j0j0C0j0j0j0C0j0C0j0j0j0j0m0j0C0j0j0C0j0j0j0j0b0V0j0j0C0j0j0j0j0V0j0j0j0V0b0V0V0C0V0C0j0j0b080u110u0V0C0j0N0j0b080b080b0j0r0b0r0b0j0j0j0j0C0j0b0r0C0j0b0j0C0C0j0j0j0j0j0j0j0j0j0b110j0b0j0j0j0C0j0C0j0j0j0j0b080b080b0V080b080b0j0j0j0j0j0j0V0j0j0u1v0j0j0j0C0j0j0j0V0C0N1c0j0C0C0j0j0j1n080b0j0V0C0j0C0C2g0j1c0j0j1v2g1v0j0j1v7N0j1c0j3L0j0j1v5Q1Z5Q1v4lfn1v420j1v5Q1Z5Q1v4l1v2z1v",
-                    "0H140r0N0r140r0u0r0V171c11140C0j0u110j0u0j1v0j0C0j0j0j0b080V0u080b0C1v0j0j0j0C0j0b080V0j0j0b080b0j0j0j0j0b080b0C080j0b080b0j0j0j0j0j0j0b080j0b080C0b080b080b080b0j0j0j0j080b0j0C0j0j0j0b0j0j080C0b0j0j0j0j0j0j0b08080b0j0C0j0j0j0b0j0j0K0b0j0C0j0j0j0b080b080j0C0b0j080b080b0j0j0j0j080b0j0b0r0j0j0j0b0j0C0r0b0j0j0j0j0j0j0j0b080j0b0r0C0j0b0j0j0j0r0b0j0C0j0j0j0u0r0b0C0j080b0j0j0j0j0j0j0j1c0j0b0j0j0j0C0j0j0j0j0j0j0j0b080j1c0u0j0j0j0C0j1c0j0u0j1c0j0j0j0j0j0j0j0j1c0j0u1v0j0j0V0j0j2g0j0j0j0C1v0C1G0j0j0V0C1Z1O0j0V0j0j2g1v0j0j0V0C2g5x1v4l1v421O7N0V0C4l1v2S1c0j1v2S2_",
-                    "050b080C0j0j0j0C0j0j0C0j0j0j0C0j0C0j0C030j0j0j0j0j0j0j0j0j0C0j0b080u0V080b0j0j0V0j0j0j0j0j0j0j0j0j0V0N0j0C0C0j0j0j0j0j0j0j0j1c0j0u0j1v0j0j0j0j0j0b080b080j0j0j0b080b080b080b080b0j0j0j080b0j0b080j0j0j0j0b080b0j0j0r0b080b0b080j0j0j0j0b080b080j0b080j0b080b080b080b080b0j0j0r0b0j0b080j0j0j0j0b080b0j0j0C080b0b080j0j0j0j0j0j0j0b080u080j0j0b0j0j0j0C0j0b080j0j0j0j0b080b080b080b0C080b080b080b0j0j0j0j0j0j0b0C080j0j0b0j0j0j0C0j0b080j0j0C0b080b080j0b0j0j0C080b0j0j0j0j0j0j0b0j0j080C0b0j080b0j0j0j0j0j0j0j0C0j0j0j0b0j0j0C080b0j0j0j0j0j0j0b080b080b0K0b080b080b0j0j0j0j0j0j0j0C0j0j0u0j0j0V0j080b0j0C0j0j0j0b0j0r0C0b0j0j0j0j0j0j0j0j0j0C0j0b080b080b0j0C0C0j0C0j0j0j0u110u0j0j0j0j0j0j0j0j0C0j0j0u0j1c0j0j0j0j0j0j0j0j0V0C0u0j0C0C0V0C1Z0j0j0j0C0j0j0j1v0u0j1c0j0j0j0C0j0j2g0j1c1v0C1Z0V0j4l0j0V0j0j2g0j1v0j1v2S1c7N1v",
-                    "0w0j1c0j0V0j0j0V0V0V0j0m0V0j0C1c140j0j0j0C0V0C0j1v0j0N0j0C0j0j0j0V0j0j1v0N0j0j0V0j0j0j0j0j0j080b0j0j0j0j0j0j0j080b0j0C0j0j0j0b0j0j080u080b0j0j0j0j0j0j0b080b080b080C0b0j080b080b0j0j0j0j080b0j0C0j0j0j0b0j0j080u080b0j0j0j0j0j0j0b080b080b080b0r0b0j080b080b0j0j0j0j080b0j0b0r0j0j0b080b0j0j080b0j080b0j080b080b0j0j0j0j0j0b080b0r0C0b080b0j0j0j0j080b0b080b080j0j0j0b080b080b080b0j0j0j0j080b0j0b080j0j0j0j0b080b0j0j0r0b080b0j0j0j0j0j0b080b080j0b0r0b080j0b080b0j0j0j0j080b0j0b080j0j0j0j0b080b0j080b0r0b0j080b080b0j0j0j0j0j0b080b0r0C0b080b0j0j0j0j0j0j0b080j0j0j0b080b080b080b0j0j0j0r0b0j0b080j0j0j0j0b080b0r0b0r0b0j080b080b0j0j0j0j0j0j0b0r0j0j0j0b0j0j0j0j080b0j0b080j0j0j0j0b080b080b0j0r0b0j080b0j0j0j0j0j0j0j0b0r0C0b0j0j0j0j0j0j0j080b0j0C0j0j0j0b0j0C0r0b0j0j0j0j0j0j0b080b080u0r0b0j080b0j0j0j0j0j0j0j0b0r0C0u0j0j0j0C0j080b0j0C0j0j0j0u110b0j0j0j0j0j0j0j0j0j0C0j0b080b0j0j0C0C0j0C0j0j0j0b0j1c0j080b0j0j0j0j0j0j0V0j0j0u0j1c0j0j0j0C0j0j2g0j0j0j0C0j0j0V0j0b080b1c0C0V0j0j2g0j0j0V0j0j1c0j1Z0j0j0C0C0j1v",
-                    "160j0j0V0j1c0j0C0j0C0j1f0j0V0C0j0j0C0j0j0j1G080b080u0V080b0j0j0V0j1v0j0u0j1c0j0j0j0C0j0j0j0C0C0j1D0b0j080b0j0j0j0j0C0j0b0r0C0j0b0j0C0C0j0j0j0j0j0j0j0j0j0b0r0b0r0j0b0j0j0j0C0j0b0r0j0j0j0b080b080j0b0C0j080b080b0j0j0j0j0j0j0b0C080j0j0b0j0j0j0C0j0b080j0j0j0j0b080b080j0b0C0r0j0b0j0j0j0j0j0j0b0C080j0j0b0j0j0j0C0j0j0j0j0C0j0j0b080b0j0j0C080b0j0j0j0j0j0j0b080b080b080C0b080b080b080b0j0j0j0j0j0b080C0j0j0b080b0j0j0C080b0j0j0j0j0j0j0b080j0b0C080j0j0b0j0j0j0j0j0j0b080j0b080C0b080b080b080b0j0j0j0j080b0j0C0j0j0b080b0j0j0C080b0j0j0j0j0j0j0b080j0b080u080j0j0b0j0j0j0j0j0j0b080C0j0j0b080b0j0j0C0j0j080b0j0j0j0j0j0b080b0C0r0b080b0j0j0j0j0j0j0b080j0b080u080b080b080b0j0j0j0C0j0b080j0j0j0j0b0j0j0j0C0j0j080b0j0j0j0j0j0b080b0C0r0b080b0j0j0j0j0j0j0b080j0b0r0b080b080b080b0j0j0j0r0b0j0b0r0j0j0j0b0j0j0j0r0b0j080b0j0j0j0j0j0j0j0b0r0C0b0j0j0j0j0j0j0j0b080j0C0u080b080b0j0j0j0r0b0j0C0C0j0b0j110b0j080b0j0j0j0j0j0j0u0r0C0b0j0j0j0j0j0j0j0j0j0C0j0j0j0b0j1c0j0C0j0j0j0b0j0814080b080b0j0j0j0j0j0j1c0j0u0j0j0V0j0j0j0j0j0j0j0u110u0j0j0j",
-                    "020b0r0C0j0j0j0C0j0j0V0j0j0j0j0j0C0j1f0j0C0j0V1G0j0j0j0j0V0C0j0C1v0u0j0j0j0V0j0j0C0j0j0j1v0N0C0V0j0j0j0K0C250b0C0V0j0j0V0j0j2g0C0V0j0j0C0j0j0b081v0N0j0j0V0V0j0j0u0j1c0j080b0j0j0j0j0j0j0V0j0j0u0j0j0V0j0j0j0C0j0b080b080V0b0j080b0j0j0j0j0j0j0j0b0r0C0j0b0j0j0j0C0j080b0j0j0j0j0j0j0u0r0C0u0j0j0j0j0j0j0b080j0C0j0b080b080b0j0C0j080b0j0j0j0j0j0j0b080b110b0j0j0j0j0j0j0j0j0j0b0r0j0j0j0b0j0j0j0r0b0j0b080j0j0j0j0b080b080b080b0r0b0j080b080b0j0j0j0j0j0j0b0r0C0b080b0j0j0j0j080b0j0b080j0j0j0j0b080b080b0j0j0j0r0b0j0j0j0j0j0j0b080b0j080C0b0j080b080b0j0j0j0j080b0j0b0r0C0b080b0j0j0j0j080b0j0j0j0j0j0b080b080b080b0j0j080b0r0b0j0j0j0j0j0j0b0j0j080C0b0j080b080b0j0j0j0j0j0b080C0j0j0b080b0j0j0C0j0b080j0j0j0j0b080b080b080b0C0C080b0j0j0j0j0j0j0b0C0C080b080b080b0j0j0j0j0j0j0b0C080j0j0b0j0j0j0C0j0b080j0b080j0j0b080b080b080b0C0r0b0j0j0j0j0j0j0b080b0r0b0r0b0j080b080b0j0j0j0j0j0j0b0r0C0j0b0j0j0j0j0j0j0b080j0C0j0b080j0b0j0j0K0b0j0C0j0j0j0b080b0j0K0b0j080b0j0j0j0j0j0j0V0j0j0b0j0j0j0C0j0j0j0j",
-                    "0l0C0K0N0r0N0j0r1G0V0m0j0V1c0C0j0j0j0j1O0N110u0j0j0j0C0j0j0V0C0j0u110u0j0j0j0C0j0j0j0C0C0j250j1c2S1v1v0j5x2g0j1c0j0j1c2z0j1c0j0j1c0j0N1v0V0C1v0C0b0C0V0j0j0C0j0C1v0u0j0C0C0j0j0j0C0j0j0j0u110u0j0j0j0C0j0C0C0C0b080b0j0C0j080b0j0C0j0j0j0u110u0j0j0j0C0j0j0j0C0j0j0j0u0C0r0u0j0j0j0j0j0j0b0r0b0V080b080b0j0C0j0j0j0V0j0j0b0j0j0j0C0j0j0j0j0j0j0j0b080j0b0C0r0j0b0j0j0j0C0j0b0r0b0r0j0b080b080b0j0C0j0j0j0j0j0j0j0j0b0j0C0r0b0j0j0j0j0j0j0b080b080j0b0r0b0r0j0b0j0j0j0j080b0j0b0r0j0j0j0b080b080b0j0j0j0j080b0j0j0j0j0j0j0b0j0j0j0r0b0j0j0j0j0j0j0b080b080b080b0r0C0b080b0j0j0j0j0j0b080b0r0C0b080b080b080b0j0j0j0j080b0j0C0j0j0j0b0j0j0C080b0j0j0j0j0j0j0b080j0b0C080j0j0b0j0j0j0j0j0j0b0r0b080j0j0b080b080b0j0j0j0j0j0j0b080j0j0j0j0b0j0j0j0r0b0j0b080j0j0j0j0j0b080b080b0C0r0b0j0j0j0j0j0j0b080b080j0C0b0j080b080b0j0j0j0j0j0j",
-                    "0a0j0j0j0j0C0j0j0C0j0C0C0j0j0j0j0j0j0j0m0C0j0j0j0j0u080j0j0j1n0j0j0j0j0C0j0j0j0V0j0j0j1c0u0j0C0V0j0j0V0j0j1v0N0C0V2o1v1O2S2o141v0j1v4l0j1c0j1v2S2o0C0u1v0j0C0C2S1v0j1c0j0j1v0N251c0j1v0b1c1v1n1v0j0j0V0j0j1v0N1v0C0V0j0j1v0b0C0j0j0V1c0j0u0j1c0j0j0j0j0j0j0j0j1c0j0u0j0j0V0j0j0j0j0j0j0b080u110u0j0j0j0j0j0j1c0j0b0j080b0j0C0j0j0j0V0j0j0u0C0V0j0j0j0C0j0b080j1c0j0b0j0j0j0C0j0C0j0j0j0b080b080b0j0C0j080b0j0j0j0j0j0j0j0b0C0r0u0j0j0j0j0j0j0b080j0b0r0C0j0b0j0j0j0r0b0j0b0r0j0j0j0b080b080b0j0r0b0j080b0j0j0j0j0j0j0b0j0r0C0b0j0j0j0j0j0j0b080j0j0C0j0j0b080b0j0j0j0j0j0j0j0j0j0j0b080b080b080b0C0j0j080b0j0j0j0j0j0j0b0j0j0C080b0j0j0j0j0j0j0j0j0b0C080j0j0b0j0j0j0j0j",
-                    "0n0Q0j1c14010q0V1c171k0u0r140V0j0j1c0C0N1O0j0V0j0j0j1c0j0u110u0C0j0C0V0C0j0j0b671v0j1v5Q1O2S2o2S1v4l1v0j1v2S2o0C1Z0j0C0C1O141v0j1c0j2z1O0j0V0j0j1v0b2H390j1c0j0V0C2z0j1c0j1v2g0C0V0j1O0b0j0j0V0C1c0j0u0j1c0j0j0j0j0j0j0j0j1c0N0j0j0V0j0j0C0j0j0b081v0u0j0j0j0C0j1c0N0j0j0C0j0j0j0C0j0j0j0u0C0r0u0j0j0j0C0j0b080j1c0j0b0j0C0C0j0C0C0j0b080b080u0C0j080b0j0C0j0j0j0u110u0j0j0j0j0j0j0j0j0C0C0j0b0j0j0j0C0j0C0C0j0b080b080b0j0C0j080b0j0C0j0j0j0b0j110b0j0j0j0j0j",
-                    "0B0j0V0j0j0C0j0j0j0C0j0C0j0j0C0j0m0j0j0j0j0C0j0C0j0j0u0j1c0j0j0C0C0j0j0j0j0j0j0j0j0u110N0j0j0V0C0V0j0b081n080b0CrU1O5e2SbX2_1Z0V2o141v0j0C0C0j2z1v0j1c0j7N1O420j1c0j1v2S1c0j1v2S2_0b0j0V0j0j1v0N1v0j0j1c0j1v140j0V0j0j0C0C0b080u1v0C0V0u110u0j0j0j0C0j0j0j0C0C0N0C0V0j0j0C0j0j0b080u110u0C0j0C0u0r0C0u080b0j0j0C0j0j0j"
-                };
-                for (const string &m: months) {
-                    int n = 0;
-                    const int size = static_cast<int>(m.length()) / 2;
-                    vector<int> l;
-                    for (int y = 0; y < size; y++) {
-                        const int z = y * 2;
-                        int t = 0;
-                        int c = 1;
-                        for (int x = 1; x > -1; x--) {
-                            t += c * static_cast<int>(chars.find(m.substr(z + x, 1)));
-                            c *= 64;
-                        }
-                        n += t;
-                        l.push_back(n);
-                    }
-                    LEAP.push_back(l);
-                }
-            });
             if (year < -1 || year > 9999) {
                 throw invalid_argument("illegal lunar year: " + std::to_string(year));
             }
@@ -2061,6 +2020,76 @@ export namespace tyme {
      */
     class FetusMonth;
 
+    /**
+     * @brief 节气缓存
+     *
+     * 按(年, 节气索引)缓存粗略儒略日和精确儒略日（均相对J2000），覆盖MIN_YEAR-MAX_YEAR年，范围外直接计算。
+     * 同一键的计算结果是确定的，并发时最多重复计算并写入相同的值，因此读取无锁。
+     */
+    class SolarTermCache {
+    public:
+        /**
+         * @brief 缓存起始年
+         */
+        static constexpr int MIN_YEAR = 1;
+
+        /**
+         * @brief 缓存结束年（含）
+         */
+        static constexpr int MAX_YEAR = 9999;
+
+        /**
+         * @brief 粗略的儒略日
+         * @param year 年
+         * @param index 节气索引(0-23)
+         * @return 相对J2000的儒略日数
+         */
+        static double get_cursory_julian_day(int year, int index);
+
+        /**
+         * @brief 精确的儒略日
+         * @param year 年
+         * @param index 节气索引(0-23)
+         * @return 相对J2000的儒略日数
+         */
+        static double get_julian_day(int year, int index);
+
+        /**
+         * @brief 命中次数
+         * @return 命中次数
+         */
+        static uint64_t get_hits();
+
+        /**
+         * @brief 未命中次数
+         * @return 未命中次数（含范围外的直接计算）
+         */
+        static uint64_t get_misses();
+
+        /**
+         * @brief 清空缓存和计数
+         */
+        static void clear();
+
+    private:
+        static constexpr int SIZE = (MAX_YEAR - MIN_YEAR + 1) * 24;
+
+        /**
+         * @brief 以double位模式存储，0表示未缓存
+         */
+        static atomic<uint64_t> cursory[SIZE];
+
+        static atomic<uint64_t> accurate[SIZE];
+
+        static atomic<uint64_t> hits;
+
+        static atomic<uint64_t> misses;
+
+        static double calc_cursory_julian_day(int year, int index);
+
+        static double get(atomic<uint64_t> *values, int year, int index, double (*calc)(int, int));
+    };
+
     /**
      * @brief 节气
      */
@@ -2129,6 +2158,69 @@ export namespace tyme {
         void init_by_year(int year, int offset);
     };
 
+    /**
+     * @brief 农历月表
+     *
+     * 预先由寿星天文历计算的农历1900-2100年数据，每年一项，按位存储：
+     * 0-12位为各月（含闰月，按位于当年的索引）是否大月，13-16位为闰月，
+     * 17-22位为正月初一相对floor((年 - 2000) * 365.2422)的天数。
+     * 表由tools/lunar_table_generator生成并校验。
+     */
+    class LunarTable {
+    public:
+        /**
+         * @brief 起始农历年
+         */
+        static constexpr int MIN_YEAR = 1900;
+
+        /**
+         * @brief 结束农历年（含）
+         */
+        static constexpr int MAX_YEAR = 2100;
+
+        static const uint32_t DATA[];
+
+        /**
+         * @brief 是否在表范围内
+         * @param year 农历年
+         * @return true/false
+         */
+        static bool contains(int year);
+
+        /**
+         * @brief 闰月
+         * @param year 农历年
+         * @return 闰月数字，0代表无闰月
+         */
+        static int get_leap_month(int year);
+
+        /**
+         * @brief 初一
+         * @param year 农历年
+         * @param index 位于当年的索引(0-12)
+         * @return 初一相对J2000的天数
+         */
+        static int get_first_day(int year, int index);
+
+        /**
+         * @brief 天数
+         * @param year 农历年
+         * @param index 位于当年的索引(0-12)
+         * @return 天数
+         */
+        static int get_day_count(int year, int index);
+
+        /**
+         * @brief 编码一年的数据
+         * @param year 农历年
+         * @param first_day 正月初一相对J2000的天数
+         * @param leap_month 闰月，0代表无闰月
+         * @param big_months 大月掩码，第i位代表位于当年索引为i的月是否30天
+         * @return 表项
+         */
+        static uint32_t encode(int year, int first_day, int leap_month, uint32_t big_months);
+    };
+
     /**
      * @brief 农历月
      */
@@ -2143,17 +2235,42 @@ export namespace tyme {
 
         LunarMonth &operator=(const LunarMonth &other);
 
-        explicit LunarMonth(const int year, const int month) : AbstractCulture(), year(LunarYear::from_year(year)), first_julian_day(0) {
+        explicit LunarMonth(const int year, const int month) : LunarMonth(year, month, true) {
+        }
+
+        /**
+         * @brief 初始化
+         * @param year 农历年
+         * @param month 农历月，闰月以负数表示
+         * @param use_table 是否查农历月表，false时总是使用寿星天文历计算
+         */
+        LunarMonth(const int year, const int month, const bool use_table) : AbstractCulture(), year(LunarYear::from_year(year)), first_julian_day(0) {
             if (month == 0 || month > 12 || month < -12) {
                 throw invalid_argument(&"illegal lunar month: "[month]);
             }
             const int m = abs(month);
             const bool leap = month < 0;
-            const int current_leap_month = this->year.get_leap_month();
+            const bool in_table = use_table && LunarTable::contains(year);
+            const int current_leap_month = in_table ? LunarTable::get_leap_month(year) : this->year.get_leap_month();
             if (leap && m != current_leap_month) {
                 throw invalid_argument("illegal leap month " + std::to_string(m) + " in lunar year" + std::to_string(year));
             }
 
+            // 位于当年的索引
+            int index = m - 1;
+            if (leap || (current_leap_month > 0 && m > current_leap_month)) {
+                index += 1;
+            }
+            this->index_in_year = index;
+            this->month = m;
+            this->leap = leap;
+
+            if (in_table) {
+                this->first_julian_day = JulianDay::from_julian_day(JulianDay::J2000 + LunarTable::get_first_day(year, index));
+                this->day_count = LunarTable::get_day_count(year, index);
+                return;
+            }
+
             // 冬至
             const double dong_zhi_jd = SolarTerm::from_index(year, 0).get_cursory_julian_day();
 
@@ -2171,21 +2288,12 @@ export namespace tyme {
                 offset = 3;
             }
 
-            // 位于当年的索引
-            int index = m - 1;
-            if (leap || (current_leap_month > 0 && m > current_leap_month)) {
-                index += 1;
-            }
-            this->index_in_year = index;
-
             // 本月初一
             w += 29.5306 * (offset + index);
             const double first_day = ShouXingUtil::calc_shuo(w);
             this->first_julian_day = JulianDay::from_julian_day(JulianDay::J2000 + first_day);
             // 本月天数 = 下月初一 - 本月初一
             this->day_count = static_cast<int>(ShouXingUtil::calc_shuo(w + 29.5306) - first_day);
-            this->month = m;
-            this->leap = leap;
         }
 
         static LunarMonth from_ym(int year, int month);
@@ -2809,11 +2917,18 @@ export namespace tyme {
         MinorRen get_minor_ren() const;
 
         /**
-         * @brief 八字
+         * @brief 八字（使用全局的八字计算接口）
          * @return 八字
          */
         EightChar get_eight_char() const;
 
+        /**
+         * @brief 八字
+         * @param provider 八字计算接口，仅本次调用有效
+         * @return 八字
+         */
+        EightChar get_eight_char(const EightCharProvider &provider) const;
+
     protected:
         /**
          * @brief 农历日
@@ -3721,9 +3836,26 @@ export namespace tyme {
          */
         vector<SolarTime> get_solar_times(int start_year, int end_year) const;
 
+        /**
+         * @brief 公历时刻列表
+         * @param start_year 开始年(含)，支持1-9999年
+         * @param end_year 结束年(含)，支持1-9999年
+         * @param parallel 是否按年段并行扫描，结果顺序与串行一致（按时间升序）
+         * @return 公历时刻列表
+         */
+        vector<SolarTime> get_solar_times(int start_year, int end_year, bool parallel) const;
+
         string get_name() const override;
 
     protected:
+        /**
+         * @brief 在指定的候选年（年干支匹配的年份）中查找公历时刻
+         * @param candidate_year 候选年
+         * @param start_year 开始年(含)
+         * @param times 结果
+         */
+        void collect_solar_times(int candidate_year, int start_year, vector<SolarTime> &times) const;
+
         /**
          * @brief 年柱
          */
@@ -4480,7 +4612,7 @@ export namespace tyme {
     /**
      * @brief 元亨利贞的童限计算
      */
-    class China95ChildLimitProvider : protected AbstractChildLimitProvider {
+    class China95ChildLimitProvider : public AbstractChildLimitProvider {
     public:
         ChildLimitInfo get_info(SolarTime birth_time, SolarTerm term) const override;
     };
@@ -4488,7 +4620,7 @@ export namespace tyme {
     /**
      * @brief Lunar的流派1童限计算（按天数和时辰数计算，3天1年，1天4个月，1时辰10天）
      */
-    class LunarSect1ChildLimitProvider : protected AbstractChildLimitProvider {
+    class LunarSect1ChildLimitProvider : public AbstractChildLimitProvider {
     public:
         ChildLimitInfo get_info(SolarTime birth_time, SolarTerm term) const override;
     };
@@ -4496,11 +4628,46 @@ export namespace tyme {
     /**
      * @brief Lunar的流派2童限计算（按分钟数计算）
      */
-    class LunarSect2ChildLimitProvider : protected AbstractChildLimitProvider {
+    class LunarSect2ChildLimitProvider : public AbstractChildLimitProvider {
     public:
         ChildLimitInfo get_info(SolarTime birth_time, SolarTerm term) const override;
     };
 
+    /**
+     * @brief 计算接口上下文
+     *
+     * 按调用传入八字、童限的计算接口，不修改全局的LunarHour::provider和ChildLimit::provider，
+     * 不同流派的计算可在多个线程中同时进行。未指定的接口使用全局接口。
+     */
+    class ProviderContext {
+    public:
+        explicit ProviderContext(const EightCharProvider *eight_char_provider = nullptr, const ChildLimitProvider *child_limit_provider = nullptr) : eight_char_provider(eight_char_provider), child_limit_provider(child_limit_provider) {
+        }
+
+        /**
+         * @brief 八字计算接口
+         * @return 八字计算接口
+         */
+        const EightCharProvider &get_eight_char_provider() const;
+
+        /**
+         * @brief 童限计算接口
+         * @return 童限计算接口
+         */
+        const ChildLimitProvider &get_child_limit_provider() const;
+
+    protected:
+        /**
+         * @brief 八字计算接口，nullptr表示使用全局接口
+         */
+        const EightCharProvider *eight_char_provider;
+
+        /**
+         * @brief 童限计算接口，nullptr表示使用全局接口
+         */
+        const ChildLimitProvider *child_limit_provider;
+    };
+
     /**
      * @brief 大运
      */
@@ -4523,11 +4690,23 @@ export namespace tyme {
 
         ~ChildLimit() = default;
 
-        explicit ChildLimit(const SolarTime &birth_time, const Gender gender): eight_char(birth_time.get_lunar_hour().get_eight_char()), gender(gender), forward(get_forward(eight_char, gender)), info(get_info(birth_time, forward)) {
+        explicit ChildLimit(const SolarTime &birth_time, const Gender gender): ChildLimit(birth_time, gender, ProviderContext()) {
+        }
+
+        explicit ChildLimit(const SolarTime &birth_time, const Gender gender, const ProviderContext &context): eight_char(birth_time.get_lunar_hour().get_eight_char(context.get_eight_char_provider())), gender(gender), forward(get_forward(eight_char, gender)), info(get_info(birth_time, forward, context.get_child_limit_provider())) {
         }
 
         static ChildLimit from_solar_time(const SolarTime &birth_time, Gender gender);
 
+        /**
+         * @brief 按指定的计算接口计算童限
+         * @param birth_time 出生公历时刻
+         * @param gender 性别
+         * @param context 计算接口上下文
+         * @return 童限
+         */
+        static ChildLimit from_solar_time(const SolarTime &birth_time, Gender gender, const ProviderContext &context);
+
         /**
          * @brief 八字
          * @return 八字
@@ -4654,7 +4833,7 @@ export namespace tyme {
     private:
         bool get_forward(const EightChar &eight_char, Gender gender);
 
-        ChildLimitInfo get_info(const SolarTime &birth_time, bool forward);
+        ChildLimitInfo get_info(const SolarTime &birth_time, bool forward, const ChildLimitProvider &provider);
     };
 
     /**
@@ -4777,7 +4956,19 @@ export namespace tyme {
         static const vector<string> NAMES;
         static string DATA;
 
-        explicit LegalHoliday(const int year, const int month, const int day, const string &data): day(SolarDay::from_ymd(year, month, day)), name(NAMES[data[9] - '0']), work(data[8] == '0'), target(compute_target(data)) {
+        explicit LegalHoliday(const int year, const int month, const int day, const string &data): LegalHoliday(year, month, day, data[9] - '0', data[8] == '0', ('-' == data[10] ? -1 : 1) * stoi(data.substr(data.length() - 2))) {
+        }
+
+        /**
+         * @brief 初始化
+         * @param year 年
+         * @param month 月
+         * @param day 日
+         * @param name_index 名称索引
+         * @param work 是否上班
+         * @param offset 距节假日当天的天数
+         */
+        LegalHoliday(const int year, const int month, const int day, const int name_index, const bool work, const int offset): day(SolarDay::from_ymd(year, month, day)), name(NAMES[name_index]), work(work), target(this->day.next(offset)) {
         }
 
         static optional<LegalHoliday> from_ymd(int year, int month, int day);
@@ -4816,7 +5007,26 @@ export namespace tyme {
         SolarDay target;
 
     private:
-        SolarDay compute_target(const string &data) const;
+        /**
+         * @brief DATA中的一条记录
+         */
+        struct Record {
+            /**
+             * @brief 日期，yyyymmdd
+             */
+            int ymd;
+            int name_index;
+            bool work;
+            int offset;
+        };
+
+        /**
+         * @brief 首次调用时解析DATA，按日期升序
+         * @return 记录列表
+         */
+        static const vector<Record> &get_records();
+
+        static LegalHoliday from_record(const Record &record);
     };
 
     /**
@@ -5155,7 +5365,10 @@ export namespace tyme {
         static const vector<string> NAMES;
         static string DATA;
 
-        explicit SolarFestival(const FestivalType type, const SolarDay &day, const int start_year, const string &data): _type(type), index(stoi(data.substr(1, 2))), day(day), name(NAMES[index]), start_year(start_year) {
+        explicit SolarFestival(const FestivalType type, const SolarDay &day, const int start_year, const string &data): SolarFestival(type, day, start_year, stoi(data.substr(1, 2))) {
+        }
+
+        explicit SolarFestival(const FestivalType type, const SolarDay &day, const int start_year, const int index): _type(type), index(index), day(day), name(NAMES[index]), start_year(start_year) {
         }
 
         static optional<SolarFestival> from_index(int year, int index);
@@ -5201,6 +5414,30 @@ export namespace tyme {
          * @brief 起始年
          */
         int start_year;
+
+    private:
+        /**
+         * @brief DATA中的一条记录
+         */
+        struct Record {
+            int index;
+            char type;
+            int month;
+            int day;
+            int start_year;
+        };
+
+        /**
+         * @brief 首次调用时解析DATA，按索引存放，缺失的索引type为0
+         * @return 记录列表
+         */
+        static const vector<Record> &get_records();
+
+        /**
+         * @brief 公历日期(mmdd)到索引，按日期升序，仅含DAY类型
+         * @return (mmdd, 索引)列表
+         */
+        static const vector<pair<int, int>> &get_day_index();
     };
 
     /**
@@ -5213,7 +5450,10 @@ export namespace tyme {
         static const vector<string> NAMES;
         static string DATA;
 
-        explicit LunarFestival(const FestivalType type, const LunarDay &day, optional<SolarTerm> solar_term, const string &data): _type(type), index(stoi(data.substr(1, 2))), day(day), name(NAMES[index]), solar_term(std::move(solar_term)) {
+        explicit LunarFestival(const FestivalType type, const LunarDay &day, optional<SolarTerm> solar_term, const string &data): LunarFestival(type, day, std::move(solar_term), stoi(data.substr(1, 2))) {
+        }
+
+        explicit LunarFestival(const FestivalType type, const LunarDay &day, optional<SolarTerm> solar_term, const int index): _type(type), index(index), day(day), name(NAMES[index]), solar_term(std::move(solar_term)) {
         }
 
         static optional<LunarFestival> from_index(int year, int index);
@@ -5259,6 +5499,33 @@ export namespace tyme {
          * @brief 节气
          */
         optional<SolarTerm> solar_term;
+
+    private:
+        /**
+         * @brief DATA中的一条记录
+         */
+        struct Record {
+            int index;
+            char type;
+            /**
+             * @brief DAY类型为农历月，TERM类型为节气索引
+             */
+            int month;
+            int day;
+        };
+
+        /**
+         * @brief 首次调用时解析DATA，按DATA中的顺序
+         * @return 记录列表
+         */
+        static const vector<Record> &get_records();
+
+        /**
+         * @brief 索引对应的记录
+         * @param index 索引
+         * @return 记录，不存在时为nullptr
+         */
+        static const Record *find_record(int index);
     };
 
     /**
@@ -5447,4 +5714,240 @@ export namespace tyme {
          */
         int day_index;
     };
+    /**
+     * @brief 批量历法转换结果（按列存放，第i项对应起始日之后的第i天）
+     */
+    class CalendarColumns {
+    public:
+        /**
+         * @brief 农历年
+         */
+        vector<int> lunar_year;
+
+        /**
+         * @brief 农历月（1-12，闰月也为正数）
+         */
+        vector<int8_t> lunar_month;
+
+        /**
+         * @brief 农历日（1-30）
+         */
+        vector<int8_t> lunar_day;
+
+        /**
+         * @brief 是否闰月（0或1）
+         */
+        vector<uint8_t> lunar_leap;
+
+        /**
+         * @brief 干支年（立春换年）的六十甲子索引
+         */
+        vector<int8_t> year_sixty_cycle;
+
+        /**
+         * @brief 干支月（节令换月）的六十甲子索引
+         */
+        vector<int8_t> month_sixty_cycle;
+
+        /**
+         * @brief 干支日的六十甲子索引
+         */
+        vector<int8_t> day_sixty_cycle;
+
+        /**
+         * @brief 当天所属节气的索引（0-23，0为冬至）
+         */
+        vector<int8_t> term;
+
+        /**
+         * @brief 天数
+         * @return 天数
+         */
+        size_t size() const;
+
+        /**
+         * @brief 预留容量
+         * @param n 天数
+         */
+        void reserve(size_t n);
+
+        /**
+         * @brief 清空（保留容量，便于分段导出时复用）
+         */
+        void clear();
+    };
+
+    /**
+     * @brief 批量历法转换
+     *
+     * 顺序扫描一段公历日，逐日递推农历日和干支，只在跨越农历月、节气、公历年时构造对应对象，
+     * 结果与逐日调用SolarDay::get_lunar_day()、get_sixty_cycle_day()、get_term()一致。
+     */
+    class CalendarBatch {
+    public:
+        /**
+         * @brief 转换[start, end)范围内的每一天
+         * @param start 起始儒略日（含）
+         * @param end 结束儒略日（不含）
+         * @return 转换结果
+         */
+        static CalendarColumns convert(const JulianDay &start, const JulianDay &end);
+
+        /**
+         * @brief 转换[start, end)范围内的每一天，结果追加到columns
+         * @param start 起始儒略日（含）
+         * @param end 结束儒略日（不含）
+         * @param columns 转换结果
+         */
+        static void convert(const JulianDay &start, const JulianDay &end, CalendarColumns &columns);
+
+        /**
+         * @brief 转换从start开始的n天，结果追加到columns
+         * @param start 起始公历日
+         * @param n 天数
+         * @param columns 转换结果
+         */
+        static void convert(const SolarDay &start, int n, CalendarColumns &columns);
+    };
+
+    /**
+     * @brief 紧凑公历日（正午儒略日数，4字节，可平凡复制）
+     */
+    struct SolarDayValue {
+        int32_t day;
+
+        auto operator<=>(const SolarDayValue &) const = default;
+    };
+
+    /**
+     * @brief 紧凑公历时刻（正午儒略日数 + 当天0点起的秒数，8字节，可平凡复制）
+     */
+    struct SolarTimeValue {
+        int32_t day;
+        int32_t second;
+
+        auto operator<=>(const SolarTimeValue &) const = default;
+    };
+
+    /**
+     * @brief 紧凑农历日（4字节，可平凡复制）
+     */
+    struct LunarDayValue {
+        int16_t year;
+
+        /**
+         * @brief 农历月，闰月以负数表示
+         */
+        int8_t month;
+
+        int8_t day;
+
+        bool operator==(const LunarDayValue &) const = default;
+    };
+
+    /**
+     * @brief 紧凑农历时辰（农历日 + 当天0点起的秒数，8字节，可平凡复制）
+     */
+    struct LunarHourValue {
+        LunarDayValue day;
+        int32_t second;
+
+        bool operator==(const LunarHourValue &) const = default;
+    };
+
+    static_assert(std::is_trivially_copyable_v<SolarDayValue> && sizeof(SolarDayValue) == 4);
+    static_assert(std::is_trivially_copyable_v<SolarTimeValue> && sizeof(SolarTimeValue) == 8);
+    static_assert(std::is_trivially_copyable_v<LunarDayValue> && sizeof(LunarDayValue) == 4);
+    static_assert(std::is_trivially_copyable_v<LunarHourValue> && sizeof(LunarHourValue) == 8);
+
+    /**
+     * @brief 公历日转紧凑值
+     * @param solar_day 公历日
+     * @return 紧凑公历日
+     */
+    SolarDayValue to_value(const SolarDay &solar_day);
+
+    /**
+     * @brief 公历时刻转紧凑值
+     * @param solar_time 公历时刻
+     * @return 紧凑公历时刻
+     */
+    SolarTimeValue to_value(const SolarTime &solar_time);
+
+    /**
+     * @brief 农历日转紧凑值
+     * @param lunar_day 农历日
+     * @return 紧凑农历日
+     */
+    LunarDayValue to_value(const LunarDay &lunar_day);
+
+    /**
+     * @brief 农历时辰转紧凑值
+     * @param lunar_hour 农历时辰
+     * @return 紧凑农历时辰
+     */
+    LunarHourValue to_value(const LunarHour &lunar_hour);
+
+    /**
+     * @brief 紧凑值转公历日
+     * @param value 紧凑公历日
+     * @return 公历日
+     */
+    SolarDay to_solar_day(SolarDayValue value);
+
+    /**
+     * @brief 紧凑值转公历时刻
+     * @param value 紧凑公历时刻
+     * @return 公历时刻
+     */
+    SolarTime to_solar_time(SolarTimeValue value);
+
+    /**
+     * @brief 紧凑值转农历日
+     * @param value 紧凑农历日
+     * @return 农历日
+     */
+    LunarDay to_lunar_day(LunarDayValue value);
+
+    /**
+     * @brief 紧凑值转农历时辰
+     * @param value 紧凑农历时辰
+     * @return 农历时辰
+     */
+    LunarHour to_lunar_hour(LunarHourValue value);
+
+    /**
+     * @brief 紧凑值转儒略日
+     * @param value 紧凑公历时刻
+     * @return 儒略日
+     */
+    JulianDay to_julian_day(SolarTimeValue value);
+
+    /**
+     * @brief 公历日转农历日（LunarTable范围内只做整数运算，不构造对象）
+     * @param value 紧凑公历日
+     * @return 紧凑农历日
+     */
+    LunarDayValue to_lunar_day_value(SolarDayValue value);
+
+    /**
+     * @brief 农历日转公历日（LunarTable范围内只做整数运算，不构造对象）
+     * @param value 紧凑农历日
+     * @return 紧凑公历日
+     */
+    SolarDayValue to_solar_day_value(LunarDayValue value);
+
+    /**
+     * @brief 公历时刻转农历时辰
+     * @param value 紧凑公历时刻
+     * @return 紧凑农历时辰
+     */
+    LunarHourValue to_lunar_hour_value(SolarTimeValue value);
+
+    /**
+     * @brief 农历时辰转公历时刻
+     * @param value 紧凑农历时辰
+     * @return 紧凑公历时刻
+     */
+    SolarTimeValue to_solar_time_value(LunarHourValue value);
 }
@@ -12,6 +12,14 @@ export namespace tyme::util {
         static const int SECOND_PER_DAY;
         static const double SECOND_PER_RAD;
 
+        /**
+         * @brief e_lon/m_lon的级数求和是否使用AVX2（编译选项ZHOUYI_SHOUXING_AVX2）
+         *
+         * 标量路径与逐项求和的原实现逐位一致；AVX2路径的单项余弦与std::cos相差不超过2 ULP，
+         * 加上求和顺序的差异，黄经的绝对误差在1e-10弧度以内，不影响定气定朔的结果。
+         */
+        static const bool SIMD;
+
         static double nutation_lon2(double t);
 
         static double e_lon(double t, int n);
@@ -63,8 +71,6 @@ export namespace tyme::util {
 
         static const double NUT_B[];
         static const double DT_AT[];
-        static const double XL0[];
-        static const std::vector<std::vector<double>> XL1;
         static const double QI_KB[];
         static const double SHUO_KB[];
         static const std::string QB;
@@ -51,9 +51,7 @@ void DaLiuRenController::display_result_detailed(const DaLiuRenResult& result) {
     fmt::print("  月柱: {}\n", result.ba_zi.month.to_string());
     fmt::print("  日柱: {}\n", result.ba_zi.day.to_string());
     fmt::print("  时柱: {}\n", result.ba_zi.hour.to_string());
-    if (!result.ba_zi.xun_kong_1.empty()) {
-        fmt::print("  旬空: {}{}\n", result.ba_zi.xun_kong_1, result.ba_zi.xun_kong_2);
-    }
+    fmt::print("  旬空: {}{}\n", Mapper::to_zh(result.ba_zi.xun_kong_1), Mapper::to_zh(result.ba_zi.xun_kong_2));
     fmt::print("\n");
     
     // 显示基本信息
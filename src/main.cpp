@@ -246,7 +246,9 @@ int main() {
         fmt::print("旬空是根据日柱计算的，因为地支比天干多2个\n");
         fmt::print("每一旬（10天）中，最后两个地支就是旬空\n");
         fmt::print("日柱 {} 的旬空: {} {}\n", 
-                   bazi1.day.to_string(), bazi1.xun_kong_1, bazi1.xun_kong_2);
+                   bazi1.day.to_string(),
+                   ZhouYi::GanZhi::Mapper::to_zh(bazi1.xun_kong_1),
+                   ZhouYi::GanZhi::Mapper::to_zh(bazi1.xun_kong_2));
         
         fmt::print(fg(fmt::color::green), "\n✅ 八字计算功能正常！旬空计算正确！\n");
         
@@ -8,6 +8,9 @@ import ZhouYi.ZiWei.Constants;
 import ZhouYi.ZiWei.Palace;
 import ZhouYi.ZiWei.Star;
 import ZhouYi.ZiWei.Horoscope;
+import ZhouYi.ZiWei.ChartTable;
+import ZhouYi.ZiWei.Chart;
+import ZhouYi.ZiWei.StarMask;
 import ZhouYi.ZhMapper;
 import ZhouYi.tyme;
 import fmt;
@@ -163,243 +166,153 @@ export namespace ZhouYi::ZiWei {
     };
 
     /**
-     * @brief 紫微斗数排盘（阳历）
-     * 
-     * @param year 阳历年
-     * @param month 阳历月
-     * @param day 阳历日
-     * @param hour 时辰（0-23）
-     * @param is_male 性别（true为男性）
-     * @return 排盘结果
+     * @brief 由本命盘表行生成排盘结果（仅做查表与拼装，不再安星）
      */
-    inline ZiWeiResult pai_pan_solar(
-        int year, int month, int day, int hour, bool is_male
+    inline ZiWeiResult materialize_chart(
+        const tyme::SolarDay& solar_day,
+        const tyme::LunarDay& lunar_day,
+        const tyme::LunarHour& lunar_hour,
+        bool is_male,
+        const array<Pillar, 4>& pillars,
+        const ZiWeiChartRow& row
     ) {
-        // 创建阳历日期
-        tyme::SolarDay solar_day = tyme::SolarDay::from_ymd(year, month, day);
-        
-        // 转换为农历并获取四柱
-        auto solar_time = tyme::SolarTime::from_ymd_hms(year, month, day, hour, 0, 0);
-        tyme::LunarDay lunar_day = solar_day.get_lunar_day();
-        tyme::LunarHour lunar_hour = solar_time.get_lunar_hour();
-        tyme::EightChar bazi = lunar_hour.get_eight_char();
-         
-        // 转换为我们的 Pillar 类型
-        auto convert_cycle = [](const tyme::SixtyCycle& cycle) -> Pillar {
-            return Pillar(
-                cycle.get_heaven_stem().get_name(),
-                cycle.get_earth_branch().get_name()
-            );
-        };
-        
-        Pillar year_pillar = convert_cycle(bazi.get_year());
-        Pillar month_pillar = convert_cycle(bazi.get_month());
-        Pillar day_pillar = convert_cycle(bazi.get_day());
-        Pillar hour_pillar = convert_cycle(bazi.get_hour());
-        
-        // 获取农历月份和日期
-        int lunar_month = lunar_day.get_month();
-        int lunar_day_num = lunar_day.get_day();
-        
-        // 获取时辰地支
-        DiZhi hour_zhi = hour_pillar.zhi;
-        
-        // 排布十二宫
-        vector<GongWeiData> palaces = arrange_twelve_palaces(
-            year_pillar.gan, lunar_month, hour_zhi
-        );
-        
-        // 找到命宫索引
-        int ming_index = -1;
-        int shen_index = -1;
-        for (size_t i = 0; i < palaces.size(); ++i) {
-            if (palaces[i].is_ming_palace) {
-                ming_index = palaces[i].index;
-            }
-            if (palaces[i].is_body_palace) {
-                shen_index = palaces[i].index;
-            }
-        }
-        
-        // 获取五行局
-        WuXingJu wu_xing_ju = palaces[ming_index].wu_xing_ju;
-        
-        // 定紫微星和天府星位置
-        int zi_wei_idx = get_zi_wei_index(lunar_day_num, wu_xing_ju);
-        int tian_fu_idx = get_tian_fu_index(zi_wei_idx);
-        
-        // 安主星
-        auto zi_wei_group = arrange_zi_wei_group(zi_wei_idx);
-        auto tian_fu_group = arrange_tian_fu_group(tian_fu_idx);
-        
-        // 获取四化表
-        auto si_hua_table = get_si_hua_table(year_pillar.gan);
-        
-        // 安辅星
-        auto [zuo_idx, you_idx] = get_zuo_you_index(lunar_month);
-        auto [chang_idx, qu_idx] = get_chang_qu_index(hour_zhi);
-        auto [kui_idx, yue_idx] = get_kui_yue_index(year_pillar.gan);
-        
-        // 安煞星
-        int lu_cun_idx = get_lu_cun_index(year_pillar.gan);
-        auto [yang_idx, tuo_idx] = get_yang_tuo_index(lu_cun_idx);
-        auto [huo_idx, ling_idx] = get_huo_ling_index(year_pillar.zhi, hour_zhi);
-        auto [kong_idx, jie_idx] = get_kong_jie_index(hour_zhi);
-        
-        // 创建结果对象（使用聚合初始化）
+        auto chart = ZiWeiChart::from_row(row);
+
         ZiWeiResult result{
             .solar_day = solar_day,
             .lunar_day = lunar_day,
             .lunar_hour = lunar_hour,
             .is_male = is_male,
-            .year_pillar = year_pillar,
-            .month_pillar = month_pillar,
-            .day_pillar = day_pillar,
-            .hour_pillar = hour_pillar,
-            .ming_gong_index = ming_index,
-            .shen_gong_index = shen_index,
-            .wu_xing_ju = wu_xing_ju,
-            .zi_wei_index = zi_wei_idx,
-            .tian_fu_index = tian_fu_idx,
+            .year_pillar = pillars[0],
+            .month_pillar = pillars[1],
+            .day_pillar = pillars[2],
+            .hour_pillar = pillars[3],
+            .ming_gong_index = chart.ming_gong_index,
+            .shen_gong_index = chart.shen_gong_index,
+            .wu_xing_ju = chart.wu_xing_ju,
+            .zi_wei_index = chart.zi_wei_index,
+            .tian_fu_index = chart.tian_fu_index,
             .palaces = {},
             .da_xian_data = {}
         };
-        
-        // 填充每个宫位的星耀
+
+        // 按星耀编号分入主星、辅星、煞星列表，名称在此解析
         for (int i = 0; i < 12; ++i) {
-            PalaceInfo palace_info;
-            palace_info.gong_data = palaces[i];
-            
-            // 添加紫微星系主星
-            for (const auto& [star, idx] : zi_wei_group) {
-                if (idx == i) {
-                    auto liang_du_table = get_zhu_xing_liang_du_table(star);
-                    StarData star_data;
-                    star_data.name = string(to_zh(star));
-                    star_data.liang_du = liang_du_table[i];
-                    star_data.gong_index = i; 
-                    
-                    // 检查四化
-                    if (si_hua_table.contains(star)) {
-                        star_data.si_hua = si_hua_table[star];
-                    }
-                    
-                    palace_info.zhu_xing.push_back(star_data);
-                }
-            }
-            
-            // 添加天府星系主星
-            for (const auto& [star, idx] : tian_fu_group) {
-                if (idx == i) {
-                    auto liang_du_table = get_zhu_xing_liang_du_table(star);
-                    StarData star_data;
-                    star_data.name = string(to_zh(star));
-                    star_data.liang_du = liang_du_table[i];
-                    star_data.gong_index = i;
-                    
-                    // 检查四化
-                    if (si_hua_table.contains(star)) {
-                        star_data.si_hua = si_hua_table[star];
-                    }
-                    
-                    palace_info.zhu_xing.push_back(star_data);
+            const ChartPalace& palace = chart.palaces[i];
+            PalaceInfo& palace_info = result.palaces[i];
+            palace_info.gong_data = GongWeiData{
+                .gong_wei = palace.gong_wei,
+                .tian_gan = palace.tian_gan,
+                .di_zhi = palace.di_zhi,
+                .is_body_palace = (i == chart.shen_gong_index),
+                .is_ming_palace = (i == chart.ming_gong_index),
+                .wu_xing_ju = (i == chart.ming_gong_index) ? chart.wu_xing_ju : WuXingJu::ShuiErJu,
+                .index = i
+            };
+
+            for (const auto& star : palace.get_stars()) {
+                StarData star_data{
+                    .name = string(star.get_name()),
+                    .liang_du = star.get_liang_du(),
+                    .gong_index = i,
+                    .si_hua = star.get_si_hua()
+                };
+                if (star.id < StarId::ZuoFu) {
+                    palace_info.zhu_xing.push_back(std::move(star_data));
+                } else if (star.id < StarId::QingYang) {
+                    palace_info.fu_xing.push_back(std::move(star_data));
+                } else {
+                    palace_info.sha_xing.push_back(std::move(star_data));
                 }
             }
-            
-            // 添加辅星
-            if (i == zuo_idx) {
-                palace_info.fu_xing.push_back(StarData{
-                    .name = string(to_zh(FuXing::ZuoFu)),
-                    .liang_du = LiangDu::Ping,
-                    .gong_index = i
-                });
-            }
-            if (i == you_idx) {
-                palace_info.fu_xing.push_back(StarData{
-                    .name = string(to_zh(FuXing::YouBi)),
-                    .liang_du = LiangDu::Ping,
-                    .gong_index = i
-                });
-            }
-            if (i == chang_idx) {
-                palace_info.fu_xing.push_back(StarData{
-                    .name = string(to_zh(FuXing::WenChang)),
-                    .liang_du = LiangDu::Ping,
-                    .gong_index = i
-                });
-            }
-            if (i == qu_idx) {
-                palace_info.fu_xing.push_back(StarData{
-                    .name = string(to_zh(FuXing::WenQu)),
-                    .liang_du = LiangDu::Ping,
-                    .gong_index = i
-                });
-            }
-            if (i == kui_idx) {
-                palace_info.fu_xing.push_back(StarData{
-                    .name = string(to_zh(FuXing::TianKui)),
-                    .liang_du = LiangDu::Ping,
-                    .gong_index = i
-                });
-            }
-            if (i == yue_idx) {
-                palace_info.fu_xing.push_back(StarData{
-                    .name = string(to_zh(FuXing::TianYue)),
-                    .liang_du = LiangDu::Ping,
-                    .gong_index = i
-                });
-            }
-            
-            // 添加煞星
-            if (i == yang_idx) {
-                palace_info.sha_xing.push_back(StarData{
-                    .name = string(to_zh(ShaXing::QingYang)),
-                    .liang_du = LiangDu::Ping,
-                    .gong_index = i
-                });
-            }
-            if (i == tuo_idx) {
-                palace_info.sha_xing.push_back(StarData{
-                    .name = string(to_zh(ShaXing::TuoLuo)),
-                    .liang_du = LiangDu::Ping,
-                    .gong_index = i
-                });
-            }
-            if (i == huo_idx) {
-                palace_info.sha_xing.push_back(StarData{
-                    .name = string(to_zh(ShaXing::HuoXing)),
-                    .liang_du = LiangDu::Ping,
-                    .gong_index = i
-                });
-            }
-            if (i == ling_idx) {
-                palace_info.sha_xing.push_back(StarData{
-                    .name = string(to_zh(ShaXing::LingXing)),
-                    .liang_du = LiangDu::Ping,
-                    .gong_index = i
-                });
-            }
-            if (i == kong_idx) {
-                palace_info.sha_xing.push_back(StarData{
-                    .name = string(to_zh(ShaXing::DiKong)),
-                    .liang_du = LiangDu::Ping,
-                    .gong_index = i
-                });
-            }
-            if (i == jie_idx) {
-                palace_info.sha_xing.push_back(StarData{
-                    .name = string(to_zh(ShaXing::DiJie)),
-                    .liang_du = LiangDu::Ping,
-                    .gong_index = i
-                });
-            }
-            
-            result.palaces[i] = palace_info;
         }
-        
+
         return result;
     }
 
+    namespace detail {
+        /**
+         * @brief 排盘输入的历法部分（阳历、农历、四柱）
+         */
+        struct PaiPanInput {
+            tyme::SolarDay solar_day;
+            tyme::LunarDay lunar_day;
+            tyme::LunarHour lunar_hour;
+            array<Pillar, 4> pillars;
+
+            ZiWeiChartKey to_chart_key() const {
+                return ZiWeiChartKey{
+                    .year_gan = pillars[0].gan,
+                    .year_zhi = pillars[0].zhi,
+                    .lunar_month = lunar_day.get_month(),
+                    .lunar_day = lunar_day.get_day(),
+                    .hour_zhi = pillars[3].zhi
+                };
+            }
+        };
+
+        inline PaiPanInput make_pai_pan_input(int year, int month, int day, int hour) {
+            // 创建阳历日期
+            tyme::SolarDay solar_day = tyme::SolarDay::from_ymd(year, month, day);
+
+            // 转换为农历并获取四柱
+            auto solar_time = tyme::SolarTime::from_ymd_hms(year, month, day, hour, 0, 0);
+            tyme::LunarDay lunar_day = solar_day.get_lunar_day();
+            tyme::LunarHour lunar_hour = solar_time.get_lunar_hour();
+            tyme::EightChar bazi = lunar_hour.get_eight_char();
+
+            return PaiPanInput{
+                .solar_day = solar_day,
+                .lunar_day = lunar_day,
+                .lunar_hour = lunar_hour,
+                .pillars = {
+                    Pillar::from_sixty_cycle(bazi.get_year()),
+                    Pillar::from_sixty_cycle(bazi.get_month()),
+                    Pillar::from_sixty_cycle(bazi.get_day()),
+                    Pillar::from_sixty_cycle(bazi.get_hour())
+                }
+            };
+        }
+    }
+
+    /**
+     * @brief 紫微斗数排盘（阳历）
+     * 
+     * @param year 阳历年
+     * @param month 阳历月
+     * @param day 阳历日
+     * @param hour 时辰（0-23）
+     * @param is_male 性别（true为男性）
+     * @return 排盘结果
+     */
+    inline ZiWeiResult pai_pan_solar(
+        int year, int month, int day, int hour, bool is_male
+    ) {
+        auto input = detail::make_pai_pan_input(year, month, day, hour);
+        return materialize_chart(
+            input.solar_day, input.lunar_day, input.lunar_hour, is_male,
+            input.pillars, compute_chart_row(input.to_chart_key())
+        );
+    }
+
+    /**
+     * @brief 紫微斗数排盘（阳历，查本命盘预计算表）
+     *
+     * 星耀安放直接取自表行，结果与不带表的重载一致。
+     *
+     * @param table 本命盘表（首次调用时映射文件）
+     */
+    inline ZiWeiResult pai_pan_solar(
+        int year, int month, int day, int hour, bool is_male,
+        const ZiWeiChartTable& table
+    ) {
+        auto input = detail::make_pai_pan_input(year, month, day, hour);
+        return materialize_chart(
+            input.solar_day, input.lunar_day, input.lunar_hour, is_male,
+            input.pillars, table.get_row(input.to_chart_key())
+        );
+    }
+
     /**
      * @brief 紫微斗数排盘（农历）
      * 
@@ -0,0 +1,172 @@
+// 紫微斗数批量排盘模块（实现）
+module ZhouYi.ZiWei.Batch;
+
+import ZhouYi.GanZhi;
+import ZhouYi.ZiWei.Constants;
+import ZhouYi.ZiWei.StarMask;
+import ZhouYi.ZiWei.ChartTable;
+import ZhouYi.tyme;
+import fmt;
+import std;
+
+namespace ZhouYi::ZiWei {
+    using namespace std;
+    using namespace ZhouYi::GanZhi;
+
+    namespace {
+        /**
+         * @brief 批量排盘的历法上下文（每个工作线程一份）
+         *
+         * 缓存最近一个阳历日的农历月日与年柱。年柱只在立春时刻更替，
+         * 若当日 0 时与 23 时的年柱相同，全天各时辰都取此年柱；
+         * 否则（立春当日）按时辰单独求年柱。
+         * 年柱与排盘一样取自 LunarHour::get_eight_char，随所选的八字提供者变化。
+         */
+        class BatchCalendar {
+        public:
+            ZiWeiChartKey get_chart_key(const BirthInput& input) {
+                if (input.hour < 0 || input.hour > 23) {
+                    throw invalid_argument(fmt::format("时辰超出范围: {}", input.hour));
+                }
+                seek(input.year, input.month, input.day);
+
+                int year_cycle = day_year_cycle_ >= 0
+                    ? day_year_cycle_
+                    : get_year_cycle(input.year, input.month, input.day, input.hour);
+                return ZiWeiChartKey{
+                    .year_gan = static_cast<TianGan>(year_cycle % 10),
+                    .year_zhi = static_cast<DiZhi>(year_cycle % 12),
+                    .lunar_month = lunar_month_,
+                    .lunar_day = lunar_day_,
+                    .hour_zhi = static_cast<DiZhi>((input.hour + 1) / 2 % 12)
+                };
+            }
+
+        private:
+            int year_ = 0;
+            int month_ = 0;
+            int day_ = 0;
+            int lunar_month_ = 0;
+            int lunar_day_ = 0;
+            int day_year_cycle_ = -1;   // 全天年柱（六十甲子序号），立春当日为 -1
+
+            static int get_year_cycle(int year, int month, int day, int hour) {
+                auto solar_time = tyme::SolarTime::from_ymd_hms(year, month, day, hour, 0, 0);
+                return solar_time.get_lunar_hour().get_eight_char().get_year().get_index();
+            }
+
+            void seek(int year, int month, int day) {
+                if (year == year_ && month == month_ && day == day_ && lunar_day_ != 0) {
+                    return;
+                }
+                auto lunar_day = tyme::SolarDay::from_ymd(year, month, day).get_lunar_day();
+                lunar_month_ = lunar_day.get_month();
+                lunar_day_ = lunar_day.get_day();
+
+                int first = get_year_cycle(year, month, day, 0);
+                int last = get_year_cycle(year, month, day, 23);
+                day_year_cycle_ = first == last ? first : -1;
+
+                year_ = year;
+                month_ = month;
+                day_ = day;
+            }
+        };
+
+        /**
+         * @brief 把一行本命盘数据写入第 i 盘的各列
+         */
+        void write_row(ZiWeiBatchColumns& columns, size_t i, const ZiWeiChartRow& row) {
+            columns.ming_gong_index[i] = row.ming_gong_index;
+            columns.shen_gong_index[i] = row.shen_gong_index;
+            columns.wu_xing_ju[i] = row.wu_xing_ju;
+
+            auto* masks = columns.star_masks.data() + i * ZiWeiBatchColumns::GONG_COUNT;
+            fill_n(masks, ZiWeiBatchColumns::GONG_COUNT, StarMask{});
+            for (int s = 0; s < static_cast<int>(ZhuXing::COUNT); ++s) {
+                masks[row.zhu_xing_gong[s]].set(to_star_id(static_cast<ZhuXing>(s)));
+            }
+            for (int f = 0; f < static_cast<int>(FuXing::COUNT); ++f) {
+                masks[row.fu_xing_gong[f]].set(to_star_id(static_cast<FuXing>(f)));
+            }
+            for (int k = 0; k < static_cast<int>(ShaXing::COUNT); ++k) {
+                masks[row.sha_xing_gong[k]].set(to_star_id(static_cast<ShaXing>(k)));
+            }
+
+            ranges::copy(row.gong_gan, columns.gong_gan.begin() + i * ZiWeiBatchColumns::GONG_COUNT);
+            ranges::copy(row.zhu_xing_liang_du,
+                columns.zhu_xing_liang_du.begin() + i * ZiWeiBatchColumns::ZHU_XING_COUNT);
+            ranges::copy(row.si_hua_xing, columns.si_hua_xing.begin() + i * ZiWeiBatchColumns::SI_HUA_COUNT);
+        }
+
+        void run_block(
+            span<const BirthInput> inputs,
+            size_t from,
+            size_t to,
+            ZiWeiBatchColumns& columns,
+            const ZiWeiChartTable* table
+        ) {
+            BatchCalendar calendar;
+            for (size_t i = from; i < to; ++i) {
+                const auto& input = inputs[i];
+                auto key = calendar.get_chart_key(input);
+                columns.chart_key[i] = static_cast<uint32_t>(key.to_index());
+                columns.is_male[i] = input.is_male ? 1 : 0;
+                if (table != nullptr) {
+                    write_row(columns, i, table->get_row(key));
+                } else {
+                    write_row(columns, i, compute_chart_row(key));
+                }
+            }
+        }
+    }
+
+    void ZiWeiBatchColumns::resize(size_t n) {
+        chart_key.resize(n);
+        is_male.resize(n);
+        ming_gong_index.resize(n);
+        shen_gong_index.resize(n);
+        wu_xing_ju.resize(n);
+        star_masks.resize(n * GONG_COUNT);
+        gong_gan.resize(n * GONG_COUNT);
+        zhu_xing_liang_du.resize(n * ZHU_XING_COUNT);
+        si_hua_xing.resize(n * SI_HUA_COUNT);
+    }
+
+    void batch_pai_pan(
+        span<const BirthInput> inputs,
+        ZiWeiBatchColumns& columns,
+        const ZiWeiBatchOptions& options
+    ) {
+        columns.resize(inputs.size());
+
+        unsigned threads = options.thread_count != 0 ? options.thread_count : thread::hardware_concurrency();
+        size_t n = min<size_t>(max(1u, threads), inputs.size());
+        if (n <= 1) {
+            run_block(inputs, 0, inputs.size(), columns, options.table);
+            return;
+        }
+
+        // 按输入顺序切成连续段，各段写入互不重叠的位置
+        auto futures = vector<future<void>>();
+        futures.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            futures.push_back(async(launch::async, [&, from = i * inputs.size() / n, to = (i + 1) * inputs.size() / n] {
+                run_block(inputs, from, to, columns, options.table);
+            }));
+        }
+        for (auto& f : futures) {
+            f.get();
+        }
+    }
+
+    ZiWeiBatchColumns batch_pai_pan(
+        span<const BirthInput> inputs,
+        const ZiWeiBatchOptions& options
+    ) {
+        ZiWeiBatchColumns columns;
+        batch_pai_pan(inputs, columns, options);
+        return columns;
+    }
+
+} // namespace ZhouYi::ZiWei
@@ -0,0 +1,93 @@
+// 紫微斗数批量排盘模块（接口）
+export module ZhouYi.ZiWei.Batch;
+
+import std;
+import ZhouYi.ZiWei.Constants;
+import ZhouYi.ZiWei.StarMask;
+import ZhouYi.ZiWei.ChartTable;
+
+export namespace ZhouYi::ZiWei {
+    using namespace std;
+
+    /**
+     * @brief 批量排盘的单条出生信息（阳历）
+     */
+    struct BirthInput {
+        int year;
+        int month;
+        int day;
+        int hour;           // 0-23
+        bool is_male;
+    };
+
+    /**
+     * @brief 批量排盘选项
+     */
+    struct ZiWeiBatchOptions {
+        unsigned thread_count = 1;                  // 工作线程数，0 表示按硬件并发数
+        const ZiWeiChartTable* table = nullptr;     // 本命盘表，为空时逐盘计算
+    };
+
+    /**
+     * @brief 批量排盘结果（列式存放，第 i 盘的宫位数据位于 [i * 12, i * 12 + 12)）
+     *
+     * 宫位索引均以寅宫为 0，枚举均存数值，便于直接写出列式文件。
+     */
+    struct ZiWeiBatchColumns {
+        static constexpr size_t GONG_COUNT = 12;
+        static constexpr size_t ZHU_XING_COUNT = static_cast<size_t>(ZhuXing::COUNT);
+        static constexpr size_t SI_HUA_COUNT = static_cast<size_t>(SiHua::COUNT);
+
+        // 每盘一项
+        vector<uint32_t> chart_key;             // 本命盘表行号（ZiWeiChartKey::to_index）
+        vector<uint8_t> is_male;
+        vector<uint8_t> ming_gong_index;        // 命宫索引
+        vector<uint8_t> shen_gong_index;        // 身宫索引
+        vector<uint8_t> wu_xing_ju;             // 五行局（WuXingJu 数值）
+
+        // 每盘 12 项
+        vector<StarMask> star_masks;            // 各宫主星、六吉、六煞占位（同 ZiWeiChart::get_star_masks）
+        vector<uint8_t> gong_gan;               // 各宫宫干（TianGan 数值）
+
+        // 每盘 14 项 / 4 项
+        vector<uint8_t> zhu_xing_liang_du;      // 十四主星亮度（LiangDu 数值）
+        vector<int8_t> si_hua_xing;             // 禄权科忌所化主星（ZhuXing 数值，-1 表示无）
+
+        size_t size() const {
+            return chart_key.size();
+        }
+
+        /**
+         * @brief 调整为 n 盘（保留已有容量，便于复用缓冲区）
+         */
+        void resize(size_t n);
+
+        span<const StarMask, GONG_COUNT> get_star_masks(size_t i) const {
+            return span<const StarMask, GONG_COUNT>(star_masks.data() + i * GONG_COUNT, GONG_COUNT);
+        }
+    };
+
+    /**
+     * @brief 批量排盘，结果写入 columns（覆盖原内容）
+     *
+     * 不构造 ZiWeiResult，也不生成任何字符串。每个工作线程处理连续一段输入，
+     * 并持有自己的历法上下文：同一阳历日只换算一次农历与年柱，
+     * 按日期排序的输入几乎不再重复查询历法。
+     *
+     * @throws invalid_argument 日期或时辰无效
+     */
+    void batch_pai_pan(
+        span<const BirthInput> inputs,
+        ZiWeiBatchColumns& columns,
+        const ZiWeiBatchOptions& options = {}
+    );
+
+    /**
+     * @brief 批量排盘（返回新的列式结果）
+     */
+    ZiWeiBatchColumns batch_pai_pan(
+        span<const BirthInput> inputs,
+        const ZiWeiBatchOptions& options = {}
+    );
+
+} // namespace ZhouYi::ZiWei
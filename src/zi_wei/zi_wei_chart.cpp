@@ -0,0 +1,100 @@
+// 紫微斗数紧凑命盘模块（实现）
+module ZhouYi.ZiWei.Chart;
+
+import ZhouYi.GanZhi;
+import ZhouYi.ZiWei.Constants;
+import ZhouYi.ZiWei.StarMask;
+import ZhouYi.ZiWei.ChartTable;
+import ZhouYi.ZiWei.Palace;
+import std;
+
+namespace ZhouYi::ZiWei {
+    using namespace std;
+    using namespace ZhouYi::GanZhi;
+
+    void ChartPalace::add_star(const ChartStar& star) {
+        if (star_count >= CAPACITY) {
+            throw logic_error("宫位星耀超出容量");
+        }
+        stars[star_count++] = star;
+        mask.set(star.id);
+    }
+
+    const ChartPalace& ZiWeiChart::get_palace(GongWei gong_wei) const {
+        for (const auto& palace : palaces) {
+            if (palace.gong_wei == gong_wei) {
+                return palace;
+            }
+        }
+        throw runtime_error("未找到指定宫位");
+    }
+
+    GongStarMasks ZiWeiChart::get_star_masks() const {
+        GongStarMasks masks{};
+        for (int i = 0; i < 12; ++i) {
+            masks[i] = palaces[i].mask;
+        }
+        return masks;
+    }
+
+    ZiWeiChart ZiWeiChart::from_row(const ZiWeiChartRow& row) {
+        // 宫位名称从命宫开始顺时针排列
+        constexpr GongWei gong_wei_order[] = {
+            GongWei::MingGong, GongWei::XiongDiGong, GongWei::FuQiGong,
+            GongWei::ZiNvGong, GongWei::CaiBoGong, GongWei::JiBingGong,
+            GongWei::QianYiGong, GongWei::NuPuGong, GongWei::GuanLuGong,
+            GongWei::TianZhaiGong, GongWei::FuDeGong, GongWei::FuMuGong
+        };
+
+        ZiWeiChart chart{
+            .ming_gong_index = row.ming_gong_index,
+            .shen_gong_index = row.shen_gong_index,
+            .wu_xing_ju = static_cast<WuXingJu>(row.wu_xing_ju),
+            .zi_wei_index = row.zi_wei_index,
+            .tian_fu_index = row.tian_fu_index,
+            .palaces = {}
+        };
+
+        for (int i = 0; i < 12; ++i) {
+            auto& palace = chart.palaces[i];
+            palace.gong_wei = gong_wei_order[fix_index(i - chart.ming_gong_index)];
+            palace.tian_gan = static_cast<TianGan>(row.gong_gan[i]);
+            palace.di_zhi = get_ming_zhi(i);
+        }
+
+        // 主星
+        for (int s = 0; s < static_cast<int>(ZhuXing::COUNT); ++s) {
+            int8_t si_hua = -1;
+            for (int h = 0; h < static_cast<int>(SiHua::COUNT); ++h) {
+                if (row.si_hua_xing[h] == s) {
+                    si_hua = static_cast<int8_t>(h);
+                }
+            }
+            chart.palaces[row.zhu_xing_gong[s]].add_star(ChartStar{
+                .id = to_star_id(static_cast<ZhuXing>(s)),
+                .liang_du = row.zhu_xing_liang_du[s],
+                .si_hua = si_hua
+            });
+        }
+
+        // 辅星、煞星（亮度统一记为平）
+        constexpr auto ping = static_cast<uint8_t>(LiangDu::Ping);
+        for (int f = 0; f < static_cast<int>(FuXing::COUNT); ++f) {
+            chart.palaces[row.fu_xing_gong[f]].add_star(ChartStar{
+                .id = to_star_id(static_cast<FuXing>(f)), .liang_du = ping, .si_hua = -1
+            });
+        }
+        for (int k = 0; k < static_cast<int>(ShaXing::COUNT); ++k) {
+            chart.palaces[row.sha_xing_gong[k]].add_star(ChartStar{
+                .id = to_star_id(static_cast<ShaXing>(k)), .liang_du = ping, .si_hua = -1
+            });
+        }
+
+        return chart;
+    }
+
+    ZiWeiChart ZiWeiChart::from_key(const ZiWeiChartKey& key) {
+        return from_row(compute_chart_row(key));
+    }
+
+} // namespace ZhouYi::ZiWei
@@ -0,0 +1,97 @@
+// 紫微斗数紧凑命盘模块（接口）
+export module ZhouYi.ZiWei.Chart;
+
+import std;
+import ZhouYi.GanZhi;
+import ZhouYi.ZiWei.Constants;
+import ZhouYi.ZiWei.StarMask;
+import ZhouYi.ZiWei.ChartTable;
+
+export namespace ZhouYi::ZiWei {
+    using namespace std;
+    using namespace ZhouYi::GanZhi;
+
+    /**
+     * @brief 紧凑星耀（3 字节，名称在渲染时由 StarId 解析）
+     */
+    struct ChartStar {
+        StarId id;
+        uint8_t liang_du;       // LiangDu 数值
+        int8_t si_hua;          // SiHua 数值，-1 表示无
+
+        LiangDu get_liang_du() const {
+            return static_cast<LiangDu>(liang_du);
+        }
+
+        optional<SiHua> get_si_hua() const {
+            return si_hua < 0 ? nullopt : optional<SiHua>(static_cast<SiHua>(si_hua));
+        }
+
+        string_view get_name() const {
+            return star_name(id);
+        }
+    };
+
+    /**
+     * @brief 紧凑宫位（星耀以定长数组内联存放）
+     */
+    struct ChartPalace {
+        // 同宫主星至多 2 颗，加六吉六煞共 14 颗，留余量
+        static constexpr size_t CAPACITY = 16;
+
+        GongWei gong_wei;
+        TianGan tian_gan;
+        DiZhi di_zhi;
+        uint8_t star_count;
+        array<ChartStar, CAPACITY> stars;
+        StarMask mask;          // 本宫星耀占位
+
+        span<const ChartStar> get_stars() const {
+            return {stars.data(), star_count};
+        }
+
+        /**
+         * @brief 加入一颗星（超出容量抛出 logic_error）
+         */
+        void add_star(const ChartStar& star);
+    };
+
+    /**
+     * @brief 紧凑本命盘
+     *
+     * 全部数据内联，可平凡复制；构建过程不做堆分配。
+     * 星耀顺序与 pai_pan_solar 相同：主星、辅星、煞星，各按枚举顺序。
+     */
+    struct ZiWeiChart {
+        int ming_gong_index;            // 命宫索引（以寅宫为0）
+        int shen_gong_index;            // 身宫索引
+        WuXingJu wu_xing_ju;            // 五行局
+        int zi_wei_index;               // 紫微星索引
+        int tian_fu_index;              // 天府星索引
+        array<ChartPalace, 12> palaces; // 从寅宫开始的十二宫
+
+        const ChartPalace& get_palace(GongWei gong_wei) const;
+
+        const ChartPalace& get_palace_by_index(int index) const {
+            return palaces[fix_index(index)];
+        }
+
+        /**
+         * @brief 十二宫星耀掩码（可直接交给 GeJuAnalyzer）
+         */
+        GongStarMasks get_star_masks() const;
+
+        /**
+         * @brief 由本命盘表行构建
+         */
+        static ZiWeiChart from_row(const ZiWeiChartRow& row);
+
+        /**
+         * @brief 由查表键直接安星构建
+         */
+        static ZiWeiChart from_key(const ZiWeiChartKey& key);
+    };
+
+    static_assert(is_trivially_copyable_v<ZiWeiChart>);
+
+} // namespace ZhouYi::ZiWei
@@ -0,0 +1,288 @@
+// 紫微斗数本命盘预计算表模块（实现）
+module;
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+module ZhouYi.ZiWei.ChartTable;
+
+import ZhouYi.GanZhi;
+import ZhouYi.ZiWei.Constants;
+import ZhouYi.ZiWei.Palace;
+import ZhouYi.ZiWei.Star;
+import fmt;
+import std;
+
+namespace ZhouYi::ZiWei {
+    using namespace std;
+    using namespace ZhouYi::GanZhi;
+
+    namespace {
+        /**
+         * @brief 表文件头（64 字节，保证行数据按缓存行对齐）
+         */
+        struct ChartTableHeader {
+            array<char, 8> magic;
+            uint32_t version;
+            uint32_t row_size;
+            uint32_t row_count;
+            array<uint8_t, 44> reserved;
+        };
+
+        static_assert(sizeof(ChartTableHeader) == 64);
+
+        constexpr array<char, 8> CHART_TABLE_MAGIC = {'Z', 'W', 'C', 'H', 'A', 'R', 'T', '\0'};
+        constexpr uint32_t CHART_TABLE_VERSION = 1;
+
+        constexpr ChartTableHeader make_header() {
+            return ChartTableHeader{
+                .magic = CHART_TABLE_MAGIC,
+                .version = CHART_TABLE_VERSION,
+                .row_size = sizeof(ZiWeiChartRow),
+                .row_count = static_cast<uint32_t>(ZiWeiChartKey::COUNT),
+                .reserved = {}
+            };
+        }
+    }
+
+    // ============= ZiWeiChartKey =============
+
+    size_t ZiWeiChartKey::to_index() const {
+        int gan = static_cast<int>(year_gan);
+        int zhi = static_cast<int>(year_zhi);
+        int hour = static_cast<int>(hour_zhi);
+        if (gan < 0 || gan > 9 || zhi < 0 || zhi > 11 || gan % 2 != zhi % 2) {
+            throw invalid_argument("年干支阴阳不配");
+        }
+        if (lunar_month == 0 || lunar_month < -12 || lunar_month > 12) {
+            throw invalid_argument(fmt::format("农历月越界: {}", lunar_month));
+        }
+        if (lunar_day < 1 || lunar_day > 30) {
+            throw invalid_argument(fmt::format("农历日越界: {}", lunar_day));
+        }
+        if (hour < 0 || hour > 11) {
+            throw invalid_argument("时支越界");
+        }
+
+        // 六十甲子序号：序号 % 10 为干，序号 % 12 为支
+        size_t cycle = static_cast<size_t>(fix_index(6 * gan - 5 * zhi, 60));
+        // 平月 1-12 记为 0-11，闰月 1-12 记为 12-23
+        size_t month = lunar_month > 0 ? lunar_month - 1 : 11 - lunar_month;
+        return ((cycle * 24 + month) * 30 + (lunar_day - 1)) * 12 + hour;
+    }
+
+    ZiWeiChartKey ZiWeiChartKey::from_index(size_t index) {
+        if (index >= COUNT) {
+            throw invalid_argument(fmt::format("行号越界: {}", index));
+        }
+        int hour = static_cast<int>(index % 12);
+        index /= 12;
+        int day = static_cast<int>(index % 30) + 1;
+        index /= 30;
+        int month = static_cast<int>(index % 24);
+        int cycle = static_cast<int>(index / 24);
+
+        return ZiWeiChartKey{
+            .year_gan = static_cast<TianGan>(cycle % 10),
+            .year_zhi = static_cast<DiZhi>(cycle % 12),
+            .lunar_month = month < 12 ? month + 1 : 11 - month,
+            .lunar_day = day,
+            .hour_zhi = static_cast<DiZhi>(hour)
+        };
+    }
+
+    // ============= 单行计算 =============
+
+    ZiWeiChartRow compute_chart_row(const ZiWeiChartKey& key) {
+        ZiWeiChartRow row{};
+
+        // 命身宫与五行局（与 arrange_twelve_palaces 同法，但不构造宫位列表）
+        auto [ming_index, shen_index] = get_ming_shen_index(key.lunar_month, key.hour_zhi);
+        TianGan ming_gan = get_ming_gan(key.year_gan, ming_index);
+        WuXingJu wu_xing_ju = get_wu_xing_ju(ming_gan, get_ming_zhi(ming_index));
+        for (int i = 0; i < 12; ++i) {
+            row.gong_gan[i] = static_cast<uint8_t>((static_cast<int>(ming_gan) + fix_index(i - ming_index)) % 10);
+        }
+
+        int zi_wei_idx = get_zi_wei_index(key.lunar_day, wu_xing_ju);
+        int tian_fu_idx = get_tian_fu_index(zi_wei_idx);
+
+        row.ming_gong_index = static_cast<uint8_t>(ming_index);
+        row.shen_gong_index = static_cast<uint8_t>(shen_index);
+        row.wu_xing_ju = static_cast<uint8_t>(wu_xing_ju);
+        row.zi_wei_index = static_cast<uint8_t>(zi_wei_idx);
+        row.tian_fu_index = static_cast<uint8_t>(tian_fu_idx);
+
+        // 主星及亮度
+        auto positions = get_zhu_xing_positions(zi_wei_idx);
+        for (int s = 0; s < static_cast<int>(ZhuXing::COUNT); ++s) {
+            row.zhu_xing_gong[s] = static_cast<uint8_t>(positions[s]);
+            row.zhu_xing_liang_du[s] = static_cast<uint8_t>(
+                get_zhu_xing_liang_du_table(static_cast<ZhuXing>(s))[positions[s]]);
+        }
+
+        // 生年四化
+        auto si_hua_xing = get_si_hua_xing(key.year_gan);
+        for (int h = 0; h < static_cast<int>(SiHua::COUNT); ++h) {
+            row.si_hua_xing[h] = static_cast<int8_t>(si_hua_xing[h]);
+        }
+
+        // 六吉星
+        auto [zuo_idx, you_idx] = get_zuo_you_index(key.lunar_month);
+        auto [chang_idx, qu_idx] = get_chang_qu_index(key.hour_zhi);
+        auto [kui_idx, yue_idx] = get_kui_yue_index(key.year_gan);
+        row.fu_xing_gong = {
+            static_cast<uint8_t>(zuo_idx), static_cast<uint8_t>(you_idx),
+            static_cast<uint8_t>(chang_idx), static_cast<uint8_t>(qu_idx),
+            static_cast<uint8_t>(kui_idx), static_cast<uint8_t>(yue_idx)
+        };
+
+        // 六煞星
+        int lu_cun_idx = get_lu_cun_index(key.year_gan);
+        auto [yang_idx, tuo_idx] = get_yang_tuo_index(lu_cun_idx);
+        auto [huo_idx, ling_idx] = get_huo_ling_index(key.year_zhi, key.hour_zhi);
+        auto [kong_idx, jie_idx] = get_kong_jie_index(key.hour_zhi);
+        row.sha_xing_gong = {
+            static_cast<uint8_t>(yang_idx), static_cast<uint8_t>(tuo_idx),
+            static_cast<uint8_t>(huo_idx), static_cast<uint8_t>(ling_idx),
+            static_cast<uint8_t>(kong_idx), static_cast<uint8_t>(jie_idx)
+        };
+
+        return row;
+    }
+
+    MinorStarPositions place_all_stars(const ZiWeiChartKey& key, bool is_male) {
+        auto [ming_index, shen_index] = get_ming_shen_index(key.lunar_month, key.hour_zhi);
+        TianGan ming_gan = get_ming_gan(key.year_gan, ming_index);
+        WuXingJu wu_xing_ju = get_wu_xing_ju(ming_gan, get_ming_zhi(ming_index));
+        return place_minor_stars(
+            key.year_gan, key.year_zhi, key.lunar_month, key.lunar_day, key.hour_zhi,
+            ming_index, shen_index, wu_xing_ju, is_male
+        );
+    }
+
+    // ============= 表生成 =============
+
+    void write_chart_table(const string& path) {
+        vector<ZiWeiChartRow> rows(ZiWeiChartKey::COUNT);
+        for (size_t i = 0; i < rows.size(); ++i) {
+            rows[i] = compute_chart_row(ZiWeiChartKey::from_index(i));
+        }
+
+        ofstream out(path, ios::binary | ios::trunc);
+        if (!out) {
+            throw runtime_error(fmt::format("无法写入本命盘表: {}", path));
+        }
+
+        constexpr ChartTableHeader header = make_header();
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(rows.data()),
+                  static_cast<streamsize>(rows.size() * sizeof(ZiWeiChartRow)));
+        if (!out) {
+            throw runtime_error(fmt::format("写入本命盘表失败: {}", path));
+        }
+    }
+
+    // ============= ZiWeiChartTable =============
+
+    ZiWeiChartTable::ZiWeiChartTable(string path) : path_(std::move(path)) {}
+
+    ZiWeiChartTable::~ZiWeiChartTable() {
+        unload();
+    }
+
+    const ZiWeiChartRow& ZiWeiChartTable::get_row(const ZiWeiChartKey& key) const {
+        call_once(load_flag_, [this] { load(); });
+        return rows_.load(memory_order_acquire)[key.to_index()];
+    }
+
+    void ZiWeiChartTable::load() const {
+        constexpr size_t expected_size = sizeof(ChartTableHeader) + ZiWeiChartKey::COUNT * sizeof(ZiWeiChartRow);
+
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path_.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw runtime_error(fmt::format("无法打开本命盘表: {}", path_));
+        }
+        LARGE_INTEGER file_size{};
+        if (!GetFileSizeEx(file, &file_size) || static_cast<size_t>(file_size.QuadPart) != expected_size) {
+            CloseHandle(file);
+            throw runtime_error(fmt::format("本命盘表大小不符: {}", path_));
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr) {
+            throw runtime_error(fmt::format("无法映射本命盘表: {}", path_));
+        }
+        void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (data == nullptr) {
+            CloseHandle(mapping);
+            throw runtime_error(fmt::format("无法映射本命盘表: {}", path_));
+        }
+        mapping_handle_ = mapping;
+#else
+        int fd = ::open(path_.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw runtime_error(fmt::format("无法打开本命盘表: {}", path_));
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) != expected_size) {
+            ::close(fd);
+            throw runtime_error(fmt::format("本命盘表大小不符: {}", path_));
+        }
+        void* data = ::mmap(nullptr, expected_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED) {
+            throw runtime_error(fmt::format("无法映射本命盘表: {}", path_));
+        }
+        // 查表为随机访问，关闭预读
+        ::madvise(data, expected_size, MADV_RANDOM);
+#endif
+
+        mapping_ = data;
+        mapping_size_ = expected_size;
+
+        ChartTableHeader header;
+        memcpy(&header, data, sizeof(header));
+        if (header.magic != CHART_TABLE_MAGIC ||
+            header.version != CHART_TABLE_VERSION ||
+            header.row_size != sizeof(ZiWeiChartRow) ||
+            header.row_count != ZiWeiChartKey::COUNT) {
+            unload();
+            throw runtime_error(fmt::format("本命盘表格式不符: {}", path_));
+        }
+
+        rows_.store(reinterpret_cast<const ZiWeiChartRow*>(static_cast<const byte*>(data) + sizeof(ChartTableHeader)),
+                    memory_order_release);
+    }
+
+    void ZiWeiChartTable::unload() const noexcept {
+        rows_.store(nullptr, memory_order_release);
+        if (mapping_ == nullptr) {
+            return;
+        }
+#if defined(_WIN32)
+        UnmapViewOfFile(mapping_);
+        CloseHandle(static_cast<HANDLE>(mapping_handle_));
+        mapping_handle_ = nullptr;
+#else
+        ::munmap(mapping_, mapping_size_);
+#endif
+        mapping_ = nullptr;
+        mapping_size_ = 0;
+    }
+
+} // namespace ZhouYi::ZiWei
@@ -0,0 +1,123 @@
+// 紫微斗数本命盘预计算表模块（接口）
+export module ZhouYi.ZiWei.ChartTable;
+
+import std;
+import ZhouYi.GanZhi;
+import ZhouYi.ZiWei.Constants;
+import ZhouYi.ZiWei.Star;
+
+export namespace ZhouYi::ZiWei {
+    using namespace std;
+    using namespace ZhouYi::GanZhi;
+
+    /**
+     * @brief 本命盘查表键
+     *
+     * 本命盘（地盘）的星耀安放只取决于年干支、农历月（含闰月）、农历日与时支，
+     * 性别不影响安星结果，故不计入键。全域共 60 × 24 × 30 × 12 = 518400 行。
+     */
+    struct ZiWeiChartKey {
+        TianGan year_gan;
+        DiZhi year_zhi;
+        int lunar_month;        // 农历月（1-12，闰月为负，与 tyme 一致）
+        int lunar_day;          // 农历日（1-30）
+        DiZhi hour_zhi;
+
+        static constexpr size_t COUNT = 60 * 24 * 30 * 12;
+
+        /**
+         * @brief 表内行号
+         * @throws invalid_argument 干支阴阳不配或月日越界
+         */
+        size_t to_index() const;
+
+        /**
+         * @brief 由行号还原查表键
+         */
+        static ZiWeiChartKey from_index(size_t index);
+    };
+
+    /**
+     * @brief 本命盘预计算行（64 字节，可直接映射）
+     *
+     * 宫位索引均以寅宫为 0；星耀按 ZhuXing / FuXing / ShaXing 顺序存放。
+     */
+    struct ZiWeiChartRow {
+        uint8_t ming_gong_index;                // 命宫索引
+        uint8_t shen_gong_index;                // 身宫索引
+        uint8_t wu_xing_ju;                     // 五行局（WuXingJu 数值）
+        uint8_t zi_wei_index;                   // 紫微星索引
+        uint8_t tian_fu_index;                  // 天府星索引
+        array<uint8_t, 12> gong_gan;            // 十二宫宫干（TianGan 数值）
+        array<uint8_t, 14> zhu_xing_gong;       // 十四主星所在宫
+        array<uint8_t, 14> zhu_xing_liang_du;   // 十四主星亮度（LiangDu 数值）
+        array<int8_t, 4> si_hua_xing;           // 禄权科忌所化主星（ZhuXing 数值，-1 表示无）
+        array<uint8_t, 6> fu_xing_gong;         // 六吉星所在宫
+        array<uint8_t, 6> sha_xing_gong;        // 六煞星所在宫
+        array<uint8_t, 3> reserved;
+    };
+
+    static_assert(sizeof(ZiWeiChartRow) == 64);
+    static_assert(is_trivially_copyable_v<ZiWeiChartRow> && is_standard_layout_v<ZiWeiChartRow>);
+
+    /**
+     * @brief 计算单行本命盘数据
+     */
+    ZiWeiChartRow compute_chart_row(const ZiWeiChartKey& key);
+
+    /**
+     * @brief 一次查表安全部辅星、煞星、杂耀与十二神
+     *
+     * 命身宫与五行局按 compute_chart_row 同法推出；性别只影响十二神顺逆与天使天伤。
+     */
+    MinorStarPositions place_all_stars(const ZiWeiChartKey& key, bool is_male);
+
+    /**
+     * @brief 穷举全部输入生成本命盘表文件
+     *
+     * 文件为 64 字节文件头加 ZiWeiChartKey::COUNT 行，按行号顺序排列，
+     * 字节序与生成机器一致（小端）。
+     *
+     * @throws runtime_error 文件无法写入
+     */
+    void write_chart_table(const string& path);
+
+    /**
+     * @brief 本命盘表（内存映射只读加载）
+     *
+     * 构造时只记录路径，首次查询时才映射文件；映射失败抛出 runtime_error，
+     * 下次查询会重新尝试。映射完成后的查询线程安全。
+     */
+    class ZiWeiChartTable {
+    public:
+        explicit ZiWeiChartTable(string path);
+        ~ZiWeiChartTable();
+
+        ZiWeiChartTable(const ZiWeiChartTable&) = delete;
+        ZiWeiChartTable& operator=(const ZiWeiChartTable&) = delete;
+
+        const string& get_path() const { return path_; }
+
+        /**
+         * @brief 文件是否已映射
+         */
+        bool is_loaded() const { return rows_.load(memory_order_acquire) != nullptr; }
+
+        /**
+         * @brief 查询一行（必要时先映射文件）
+         */
+        const ZiWeiChartRow& get_row(const ZiWeiChartKey& key) const;
+
+    private:
+        void load() const;
+        void unload() const noexcept;
+
+        string path_;
+        mutable once_flag load_flag_;
+        mutable atomic<const ZiWeiChartRow*> rows_{nullptr};
+        mutable void* mapping_ = nullptr;       // 映射起始地址
+        mutable size_t mapping_size_ = 0;
+        mutable void* mapping_handle_ = nullptr; // Windows 文件映射句柄
+    };
+
+} // namespace ZhouYi::ZiWei
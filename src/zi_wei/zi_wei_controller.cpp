@@ -8,6 +8,7 @@ import ZhouYi.ZiWei.SanFang;
 import ZhouYi.ZiWei.GeJu;
 import ZhouYi.ZiWei.StarDescription;
 import ZhouYi.ZiWei.Horoscope;
+import ZhouYi.ZiWei.Render;
 import ZhouYi.ZhMapper;
 import ZhouYi.tyme;
 import fmt;
@@ -21,10 +22,21 @@ namespace ZhouYi::ZiWei {
     using namespace ZhouYi::GanZhi;
     using namespace ZhouYi::Mapper;
 
+    namespace {
+        // 直接输出到标准输出，不经中间字符串
+        template <typename T>
+        void print_text(const T& value) {
+            fmt::memory_buffer buffer;
+            render_text(buffer, value);
+            buffer.push_back('\n');
+            fmt::print("{}", string_view(buffer.data(), buffer.size()));
+        }
+    }
+
     void pai_pan_and_print_solar(int year, int month, int day, int hour, bool is_male) {
         try {
             auto result = pai_pan_solar(year, month, day, hour, is_male);
-            fmt::print("{}\n", result.to_string());
+            print_text(result);
         } catch (const exception& e) {
             fmt::print("[错误] 排盘错误: {}\n", e.what());
         }
@@ -34,7 +46,7 @@ namespace ZhouYi::ZiWei {
                                   bool is_male, bool is_leap_month) {
         try {
             auto result = pai_pan_lunar(year, month, day, hour, is_male, is_leap_month);
-            fmt::print("{}\n", result.to_string());
+            print_text(result);
         } catch (const exception& e) {
             fmt::print("[错误] 排盘错误: {}\n", e.what());
         }
@@ -43,7 +55,8 @@ namespace ZhouYi::ZiWei {
     void display_palace_detail(const ZiWeiResult& result, GongWei gong_wei) {
         try {
             const auto& palace = result.get_palace(gong_wei);
-            fmt::print("\n{}\n", palace.to_string());
+            fmt::print("\n");
+            print_text(palace);
         } catch (const exception& e) {
             fmt::print("[错误] 获取宫位错误: {}\n", e.what());
         }
@@ -318,7 +331,8 @@ namespace ZhouYi::ZiWei {
         
         for (int idx : san_fang.get_all_indices()) {
             const auto& palace = result.palaces[idx];
-            fmt::print("{}\n\n", palace.to_string());
+            print_text(palace);
+            fmt::print("\n");
         }
     }
     
@@ -384,7 +398,9 @@ namespace ZhouYi::ZiWei {
             xiao_xian_data.gong_index,
             string(to_zh(result.palaces[xiao_xian_data.gong_index].gong_data.gong_wei)));
         
-        fmt::print("\n{}\n", result.palaces[xiao_xian_data.gong_index].to_string());
+        fmt::print("\n");
+        
+        print_text(result.palaces[xiao_xian_data.gong_index]);
     }
     
     void display_liu_nian_analysis(const ZiWeiResult& result, int target_year, int current_age) {
@@ -426,7 +442,7 @@ namespace ZhouYi::ZiWei {
         }
         
         fmt::print("\n流年宫位详情：\n");
-        fmt::print("{}\n", result.palaces[liu_nian_data.gong_index].to_string());
+        print_text(result.palaces[liu_nian_data.gong_index]);
     }
     
     void display_liu_yue_analysis(const ZiWeiResult& result, int target_year, int target_month, int current_age) {
@@ -470,7 +486,7 @@ namespace ZhouYi::ZiWei {
         }
         
         fmt::print("\n流月宫位详情：\n");
-        fmt::print("{}\n", result.palaces[liu_yue_data.gong_index].to_string());
+        print_text(result.palaces[liu_yue_data.gong_index]);
     }
     
     void display_liu_ri_analysis(const ZiWeiResult& result, int target_year, int target_month, int target_day, int current_age) {
@@ -527,7 +543,7 @@ namespace ZhouYi::ZiWei {
         }
         
         fmt::print("\n流日宫位详情：\n");
-        fmt::print("{}\n", result.palaces[liu_ri_data.gong_index].to_string());
+        print_text(result.palaces[liu_ri_data.gong_index]);
     }
     
     void display_liu_shi_analysis(const ZiWeiResult& result, int target_year, int target_month, int target_day, DiZhi target_hour, int current_age) {
@@ -594,7 +610,7 @@ namespace ZhouYi::ZiWei {
         }
         
         fmt::print("\n流时宫位详情：\n");
-        fmt::print("{}\n", result.palaces[liu_shi_data.gong_index].to_string());
+        print_text(result.palaces[liu_shi_data.gong_index]);
     }
     
     void display_yun_xian_full_analysis(const ZiWeiResult& result, int target_year, int target_month, int target_day, DiZhi target_hour, int current_age) {
@@ -641,7 +657,7 @@ namespace ZhouYi::ZiWei {
         
         // 基本信息
         fmt::print("\n【基本信息】\n");
-        fmt::print("{}\n", result.to_string());
+        print_text(result);
         
         // 格局分析
         display_ge_ju_analysis(result);
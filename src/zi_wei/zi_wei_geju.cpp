@@ -4,6 +4,7 @@ module ZhouYi.ZiWei.GeJu;
 import ZhouYi.GanZhi;
 import ZhouYi.ZiWei.Constants;
 import ZhouYi.ZiWei.SanFang;
+import ZhouYi.ZiWei.StarMask;
 import fmt;
 import std;
 import ZhouYi.ZhMapper;
@@ -29,10 +30,17 @@ namespace ZhouYi::ZiWei {
         const array<vector<string>, 12>& stars_in_gong,
         const array<DiZhi, 12>& gong_di_zhi,
         int ming_gong_index
-    ) : stars_in_gong_(stars_in_gong),
+    ) : san_fang_analyzer_(stars_in_gong),
         gong_di_zhi_(gong_di_zhi),
-        ming_gong_index_(ming_gong_index),
-        san_fang_analyzer_(stars_in_gong) {}
+        ming_gong_index_(ming_gong_index) {}
+
+    GeJuAnalyzer::GeJuAnalyzer(
+        const GongStarMasks& gong_masks,
+        const array<DiZhi, 12>& gong_di_zhi,
+        int ming_gong_index
+    ) : san_fang_analyzer_(gong_masks),
+        gong_di_zhi_(gong_di_zhi),
+        ming_gong_index_(ming_gong_index) {}
 
     vector<GeJuInfo> GeJuAnalyzer::analyze_all() const {
         vector<GeJuInfo> all_geju;
@@ -211,9 +219,10 @@ namespace ZhouYi::ZiWei {
         vector<ShuangXingInfo> shuang_xing_list;
         
         for (int i = 0; i < 12; ++i) {
-            auto zhu_xing = get_zhu_xing_in_gong(i);
+            auto zheng_yao = get_gong_mask(i) & ZHENG_YAO_MASK;
             
-            if (zhu_xing.size() == 2) {
+            if (zheng_yao.count() == 2) {
+                auto zhu_xing = zheng_yao.to_names();
                 string xing1 = zhu_xing[0];
                 string xing2 = zhu_xing[1];
                 
@@ -271,7 +280,7 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_zi_fu_tong_gong() const {
         // 检查命宫是否紫微天府同宫
-        if (gong_has_all_stars(ming_gong_index_, {"紫微", "天府"})) {
+        if (gong_has_all_stars(ming_gong_index_, {StarId::ZiWei, StarId::TianFu})) {
             return GeJuInfo{
                 .type = GeJuType::ZiFuTongGong,
                 .name = "紫府同宫",
@@ -288,8 +297,8 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_zi_fu_chao_yuan() const {
         // 紫微在命或财官，天府在三方四正
-        if (gong_has_star(ming_gong_index_, "紫微") && 
-            san_fang_analyzer_.san_fang_has_star(ming_gong_index_, "天府")) {
+        if (gong_has_star(ming_gong_index_, StarId::ZiWei) && 
+            san_fang_analyzer_.san_fang_has_star(ming_gong_index_, StarId::TianFu)) {
             return GeJuInfo{
                 .type = GeJuType::ZiFuChaoYuan,
                 .name = "紫府朝垣",
@@ -305,8 +314,8 @@ namespace ZhouYi::ZiWei {
     }
 
     optional<GeJuInfo> GeJuAnalyzer::check_tian_fu_chao_yuan() const {
-        if (gong_has_star(ming_gong_index_, "天府") && 
-            san_fang_analyzer_.san_fang_has_any_star(ming_gong_index_, {"禄存", "化禄"})) {
+        if (gong_has_star(ming_gong_index_, StarId::TianFu) && 
+            san_fang_analyzer_.san_fang_has_any_star(ming_gong_index_, {StarId::LuCun, StarId::HuaLu})) {
             return GeJuInfo{
                 .type = GeJuType::TianFuChaoYuan,
                 .name = "天府朝垣",
@@ -323,8 +332,8 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_jun_chen_qing_hui() const {
         // 紫微、天相、天府等组合
-        if (gong_has_star(ming_gong_index_, "紫微") && 
-            san_fang_analyzer_.san_fang_has_all_stars(ming_gong_index_, {"天相", "天府"})) {
+        if (gong_has_star(ming_gong_index_, StarId::ZiWei) && 
+            san_fang_analyzer_.san_fang_has_all_stars(ming_gong_index_, {StarId::TianXiang, StarId::TianFu})) {
             return GeJuInfo{
                 .type = GeJuType::JunChenQingHui,
                 .name = "君臣庆会",
@@ -340,7 +349,7 @@ namespace ZhouYi::ZiWei {
     }
 
     optional<GeJuInfo> GeJuAnalyzer::check_fu_xiang_chao_yuan() const {
-        if (gong_has_all_stars(ming_gong_index_, {"天府", "天相"})) {
+        if (gong_has_all_stars(ming_gong_index_, {StarId::TianFu, StarId::TianXiang})) {
             return GeJuInfo{
                 .type = GeJuType::FuXiangChaoYuan,
                 .name = "府相朝垣",
@@ -357,7 +366,7 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_ji_yue_tong_liang() const {
         // 天机、天同、天梁、太阴会于寅申巳亥宫
-        vector<string> ji_yue_stars = {"天机", "太阴", "天同", "天梁"};
+        constexpr StarMask ji_yue_stars{StarId::TianJi, StarId::TaiYin, StarId::TianTong, StarId::TianLiang};
         
         if (san_fang_analyzer_.san_fang_has_all_stars(ming_gong_index_, ji_yue_stars)) {
             return GeJuInfo{
@@ -366,7 +375,7 @@ namespace ZhouYi::ZiWei {
                 .description = "天机太阴天同天梁会合，清贵之格，适宜公职、学术",
                 .is_ji = true,
                 .score = 60,
-                .key_stars = ji_yue_stars,
+                .key_stars = {"天机", "太阴", "天同", "天梁"},
                 .key_gongs = {ming_gong_index_}
             };
         }
@@ -376,7 +385,7 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_ri_yue_bing_ming() const {
         // 太阳太阴在卯酉宫
-        if (gong_has_all_stars(ming_gong_index_, {"太阳", "太阴"})) {
+        if (gong_has_all_stars(ming_gong_index_, {StarId::TaiYang, StarId::TaiYin})) {
             DiZhi di_zhi = get_gong_di_zhi(ming_gong_index_);
             // 检查是否在卯宫或酉宫
             if (di_zhi == DiZhi::Mao || di_zhi == DiZhi::You) {
@@ -397,7 +406,7 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_yue_lang_tian_men() const {
         // 太阴在亥宫
-        if (gong_has_star(ming_gong_index_, "太阴")) {
+        if (gong_has_star(ming_gong_index_, StarId::TaiYin)) {
             DiZhi di_zhi = get_gong_di_zhi(ming_gong_index_);
             // 检查是否在亥宫
             if (di_zhi == DiZhi::Hai) {
@@ -418,7 +427,7 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_ming_zhu_chu_hai() const {
         // 太阴在酉宫
-        if (gong_has_star(ming_gong_index_, "太阴")) {
+        if (gong_has_star(ming_gong_index_, StarId::TaiYin)) {
             DiZhi di_zhi = get_gong_di_zhi(ming_gong_index_);
             // 检查是否在酉宫
             if (di_zhi == DiZhi::You) {
@@ -438,8 +447,8 @@ namespace ZhouYi::ZiWei {
     }
 
     optional<GeJuInfo> GeJuAnalyzer::check_yang_liang_chang_lu() const {
-        if (gong_has_all_stars(ming_gong_index_, {"太阳", "天梁"}) &&
-            san_fang_analyzer_.san_fang_has_all_stars(ming_gong_index_, {"文昌", "禄存"})) {
+        if (gong_has_all_stars(ming_gong_index_, {StarId::TaiYang, StarId::TianLiang}) &&
+            san_fang_analyzer_.san_fang_has_all_stars(ming_gong_index_, {StarId::WenChang, StarId::LuCun})) {
             return GeJuInfo{
                 .type = GeJuType::YangLiangChangLu,
                 .name = "阳梁昌禄格",
@@ -456,7 +465,7 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_tan_wu_tong_xing() const {
         // 贪狼武曲在丑未宫
-        if (gong_has_all_stars(ming_gong_index_, {"贪狼", "武曲"})) {
+        if (gong_has_all_stars(ming_gong_index_, {StarId::TanLang, StarId::WuQu})) {
             return GeJuInfo{
                 .type = GeJuType::TanWuTongXing,
                 .name = "贪武同行",
@@ -472,7 +481,7 @@ namespace ZhouYi::ZiWei {
     }
 
     optional<GeJuInfo> GeJuAnalyzer::check_huo_tan() const {
-        if (gong_has_all_stars(ming_gong_index_, {"贪狼", "火星"})) {
+        if (gong_has_all_stars(ming_gong_index_, {StarId::TanLang, StarId::HuoXing})) {
             return GeJuInfo{
                 .type = GeJuType::HuoTanGeJu,
                 .name = "火贪格",
@@ -488,7 +497,7 @@ namespace ZhouYi::ZiWei {
     }
 
     optional<GeJuInfo> GeJuAnalyzer::check_ling_tan() const {
-        if (gong_has_all_stars(ming_gong_index_, {"贪狼", "铃星"})) {
+        if (gong_has_all_stars(ming_gong_index_, {StarId::TanLang, StarId::LingXing})) {
             return GeJuInfo{
                 .type = GeJuType::LingTanGeJu,
                 .name = "铃贪格",
@@ -505,8 +514,8 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_ji_liang_jia_hui() const {
         // 天机天梁在三方四正会合
-        if ((gong_has_star(ming_gong_index_, "天机") && san_fang_analyzer_.san_fang_has_star(ming_gong_index_, "天梁")) ||
-            (gong_has_star(ming_gong_index_, "天梁") && san_fang_analyzer_.san_fang_has_star(ming_gong_index_, "天机"))) {
+        if ((gong_has_star(ming_gong_index_, StarId::TianJi) && san_fang_analyzer_.san_fang_has_star(ming_gong_index_, StarId::TianLiang)) ||
+            (gong_has_star(ming_gong_index_, StarId::TianLiang) && san_fang_analyzer_.san_fang_has_star(ming_gong_index_, StarId::TianJi))) {
             return GeJuInfo{
                 .type = GeJuType::JiLiangJiaHui,
                 .name = "机梁夹会",
@@ -523,7 +532,7 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_ri_zhao_lei_men() const {
         // 太阳在卯宫
-        if (gong_has_star(ming_gong_index_, "太阳")) {
+        if (gong_has_star(ming_gong_index_, StarId::TaiYang)) {
             DiZhi di_zhi = get_gong_di_zhi(ming_gong_index_);
             if (di_zhi == DiZhi::Mao) {
                 return GeJuInfo{
@@ -549,8 +558,8 @@ namespace ZhouYi::ZiWei {
         
         for (int gong : san_fang.get_all_indices()) {
             if (gong != ming_gong_index_) {  // 不包括本宫
-                if (gong_has_star(gong, "太阳")) has_tai_yang = true;
-                if (gong_has_star(gong, "太阴")) has_tai_yin = true;
+                if (gong_has_star(gong, StarId::TaiYang)) has_tai_yang = true;
+                if (gong_has_star(gong, StarId::TaiYin)) has_tai_yin = true;
             }
         }
         
@@ -571,8 +580,8 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_tan_ling_jia_hui() const {
         // 贪狼铃星在三方会合
-        if ((gong_has_star(ming_gong_index_, "贪狼") && san_fang_analyzer_.san_fang_has_star(ming_gong_index_, "铃星")) ||
-            (gong_has_star(ming_gong_index_, "铃星") && san_fang_analyzer_.san_fang_has_star(ming_gong_index_, "贪狼"))) {
+        if ((gong_has_star(ming_gong_index_, StarId::TanLang) && san_fang_analyzer_.san_fang_has_star(ming_gong_index_, StarId::LingXing)) ||
+            (gong_has_star(ming_gong_index_, StarId::LingXing) && san_fang_analyzer_.san_fang_has_star(ming_gong_index_, StarId::TanLang))) {
             return GeJuInfo{
                 .type = GeJuType::TanLingJiaHui,
                 .name = "贪铃夹会",
@@ -589,7 +598,7 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_san_qi_jia_hui() const {
         // 化禄、化权、化科会于三方四正
-        if (san_fang_analyzer_.san_fang_has_all_stars(ming_gong_index_, {"化禄", "化权", "化科"})) {
+        if (san_fang_analyzer_.san_fang_has_all_stars(ming_gong_index_, {StarId::HuaLu, StarId::HuaQuan, StarId::HuaKe})) {
             return GeJuInfo{
                 .type = GeJuType::SanQiJiaHui,
                 .name = "三奇嘉会",
@@ -607,8 +616,8 @@ namespace ZhouYi::ZiWei {
     optional<GeJuInfo> GeJuAnalyzer::check_shuang_lu_jia_ming() const {
         auto jia_gong = get_jia_gong_info(ming_gong_index_);
         
-        bool left_has_lu = gong_has_any_star(jia_gong.left_gong, {"禄存", "化禄"});
-        bool right_has_lu = gong_has_any_star(jia_gong.right_gong, {"禄存", "化禄"});
+        bool left_has_lu = gong_has_any_star(jia_gong.left_gong, {StarId::LuCun, StarId::HuaLu});
+        bool right_has_lu = gong_has_any_star(jia_gong.right_gong, {StarId::LuCun, StarId::HuaLu});
         
         if (left_has_lu && right_has_lu) {
             return GeJuInfo{
@@ -632,8 +641,8 @@ namespace ZhouYi::ZiWei {
         
         auto jia_gong = get_jia_gong_info(cai_bo_gong);
         
-        bool left_has_lu = gong_has_any_star(jia_gong.left_gong, {"禄存", "化禄"});
-        bool right_has_lu = gong_has_any_star(jia_gong.right_gong, {"禄存", "化禄"});
+        bool left_has_lu = gong_has_any_star(jia_gong.left_gong, {StarId::LuCun, StarId::HuaLu});
+        bool right_has_lu = gong_has_any_star(jia_gong.right_gong, {StarId::LuCun, StarId::HuaLu});
         
         if (left_has_lu && right_has_lu) {
             return GeJuInfo{
@@ -654,14 +663,8 @@ namespace ZhouYi::ZiWei {
         auto jia_gong = get_jia_gong_info(ming_gong_index_);
         
         // 检查左右宫是否有化科、化权、化禄中的任意两个
-        vector<string> si_hua_list = {"化科", "化权", "化禄"};
-        int count = 0;
-        
-        for (const auto& si_hua : si_hua_list) {
-            if (gong_has_star(jia_gong.left_gong, si_hua) || gong_has_star(jia_gong.right_gong, si_hua)) {
-                count++;
-            }
-        }
+        constexpr StarMask si_hua_list{StarId::HuaKe, StarId::HuaQuan, StarId::HuaLu};
+        int count = ((get_gong_mask(jia_gong.left_gong) | get_gong_mask(jia_gong.right_gong)) & si_hua_list).count();
         
         if (count >= 2) {
             return GeJuInfo{
@@ -681,8 +684,8 @@ namespace ZhouYi::ZiWei {
     optional<GeJuInfo> GeJuAnalyzer::check_zuo_you_jia() const{
         auto jia_gong = get_jia_gong_info(ming_gong_index_);
         
-        bool left_has_zuo = gong_has_star(jia_gong.left_gong, "左辅");
-        bool right_has_you = gong_has_star(jia_gong.right_gong, "右弼");
+        bool left_has_zuo = gong_has_star(jia_gong.left_gong, StarId::ZuoFu);
+        bool right_has_you = gong_has_star(jia_gong.right_gong, StarId::YouBi);
         
         if (left_has_zuo && right_has_you) {
             return GeJuInfo{
@@ -702,10 +705,10 @@ namespace ZhouYi::ZiWei {
     optional<GeJuInfo> GeJuAnalyzer::check_chang_qu_jia_ming() const {
         auto jia_gong = get_jia_gong_info(ming_gong_index_);
         
-        bool left_has_chang = gong_has_star(jia_gong.left_gong, "文昌");
-        bool right_has_qu = gong_has_star(jia_gong.right_gong, "文曲");
-        bool left_has_qu = gong_has_star(jia_gong.left_gong, "文曲");
-        bool right_has_chang = gong_has_star(jia_gong.right_gong, "文昌");
+        bool left_has_chang = gong_has_star(jia_gong.left_gong, StarId::WenChang);
+        bool right_has_qu = gong_has_star(jia_gong.right_gong, StarId::WenQu);
+        bool left_has_qu = gong_has_star(jia_gong.left_gong, StarId::WenQu);
+        bool right_has_chang = gong_has_star(jia_gong.right_gong, StarId::WenChang);
         
         if ((left_has_chang && right_has_qu) || (left_has_qu && right_has_chang)) {
             return GeJuInfo{
@@ -725,10 +728,10 @@ namespace ZhouYi::ZiWei {
     optional<GeJuInfo> GeJuAnalyzer::check_kui_yue_jia_ming() const {
         auto jia_gong = get_jia_gong_info(ming_gong_index_);
         
-        bool left_has_kui = gong_has_star(jia_gong.left_gong, "天魁");
-        bool right_has_yue = gong_has_star(jia_gong.right_gong, "天钺");
-        bool left_has_yue = gong_has_star(jia_gong.left_gong, "天钺");
-        bool right_has_kui = gong_has_star(jia_gong.right_gong, "天魁");
+        bool left_has_kui = gong_has_star(jia_gong.left_gong, StarId::TianKui);
+        bool right_has_yue = gong_has_star(jia_gong.right_gong, StarId::TianYue);
+        bool left_has_yue = gong_has_star(jia_gong.left_gong, StarId::TianYue);
+        bool right_has_kui = gong_has_star(jia_gong.right_gong, StarId::TianKui);
         
         if ((left_has_kui && right_has_yue) || (left_has_yue && right_has_kui)) {
             return GeJuInfo{
@@ -747,9 +750,9 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_lu_ma_jiao_chi() const {
         // 禄存天马同宫或会合
-        if (gong_has_all_stars(ming_gong_index_, {"禄存", "天马"}) ||
-            (gong_has_star(ming_gong_index_, "禄存") && san_fang_analyzer_.san_fang_has_star(ming_gong_index_, "天马")) ||
-            (gong_has_star(ming_gong_index_, "天马") && san_fang_analyzer_.san_fang_has_star(ming_gong_index_, "禄存"))) {
+        if (gong_has_all_stars(ming_gong_index_, {StarId::LuCun, StarId::TianMa}) ||
+            (gong_has_star(ming_gong_index_, StarId::LuCun) && san_fang_analyzer_.san_fang_has_star(ming_gong_index_, StarId::TianMa)) ||
+            (gong_has_star(ming_gong_index_, StarId::TianMa) && san_fang_analyzer_.san_fang_has_star(ming_gong_index_, StarId::LuCun))) {
             return GeJuInfo{
                 .type = GeJuType::LuMaJiaoChiGeJu,
                 .name = "禄马交驰",
@@ -766,7 +769,7 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_quan_lu_xun_feng() const {
         // 化权化禄在命宫或三方四正
-        if (san_fang_analyzer_.san_fang_has_all_stars(ming_gong_index_, {"化权", "化禄"})) {
+        if (san_fang_analyzer_.san_fang_has_all_stars(ming_gong_index_, {StarId::HuaQuan, StarId::HuaLu})) {
             return GeJuInfo{
                 .type = GeJuType::QuanLuXunFeng,
                 .name = "权禄巡逢",
@@ -784,7 +787,7 @@ namespace ZhouYi::ZiWei {
     // ============= 凶格判断 =============
 
     optional<GeJuInfo> GeJuAnalyzer::check_ling_chang_tuo_wu() const {
-        if (gong_has_all_stars(ming_gong_index_, {"铃星", "文昌", "陀罗", "武曲"})) {
+        if (gong_has_all_stars(ming_gong_index_, {StarId::LingXing, StarId::WenChang, StarId::TuoLuo, StarId::WuQu})) {
             return GeJuInfo{
                 .type = GeJuType::LingChangTuoWu,
                 .name = "铃昌陀武",
@@ -800,7 +803,7 @@ namespace ZhouYi::ZiWei {
     }
 
     optional<GeJuInfo> GeJuAnalyzer::check_ji_ji_tong_gong() const {
-        if (gong_has_all_stars(ming_gong_index_, {"巨门", "天机"})) {
+        if (gong_has_all_stars(ming_gong_index_, {StarId::JuMen, StarId::TianJi})) {
             DiZhi di_zhi = get_gong_di_zhi(ming_gong_index_);
             // 检查是否在辰宫或戌宫
             if (di_zhi == DiZhi::Chen || di_zhi == DiZhi::Xu) {
@@ -821,7 +824,7 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_ma_tou_dai_jian() const {
         // 擎羊在午宫守命
-        if (gong_has_star(ming_gong_index_, "擎羊")) {
+        if (gong_has_star(ming_gong_index_, StarId::QingYang)) {
             DiZhi di_zhi = get_gong_di_zhi(ming_gong_index_);
             // 检查是否在午宫
             if (di_zhi == DiZhi::Wu) {
@@ -859,10 +862,10 @@ namespace ZhouYi::ZiWei {
     optional<GeJuInfo> GeJuAnalyzer::check_kong_jie_jia_ming() const {
         auto jia_gong = get_jia_gong_info(ming_gong_index_);
         
-        bool left_has_kong = gong_has_star(jia_gong.left_gong, "地空");
-        bool right_has_jie = gong_has_star(jia_gong.right_gong, "地劫");
-        bool left_has_jie = gong_has_star(jia_gong.left_gong, "地劫");
-        bool right_has_kong = gong_has_star(jia_gong.right_gong, "地空");
+        bool left_has_kong = gong_has_star(jia_gong.left_gong, StarId::DiKong);
+        bool right_has_jie = gong_has_star(jia_gong.right_gong, StarId::DiJie);
+        bool left_has_jie = gong_has_star(jia_gong.left_gong, StarId::DiJie);
+        bool right_has_kong = gong_has_star(jia_gong.right_gong, StarId::DiKong);
         
         if ((left_has_kong && right_has_jie) || (left_has_jie && right_has_kong)) {
             return GeJuInfo{
@@ -881,7 +884,7 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_ju_ri_tong_gong() const {
         // 巨门太阳同宫
-        if (gong_has_all_stars(ming_gong_index_, {"巨门", "太阳"})) {
+        if (gong_has_all_stars(ming_gong_index_, {StarId::JuMen, StarId::TaiYang})) {
             return GeJuInfo{
                 .type = GeJuType::JuRiTongGong,
                 .name = "巨日同宫",
@@ -898,9 +901,7 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_ming_xiang_liang_jia() const {
         // 命宫无正曜（空宫）
-        auto zhu_xing = get_zhu_xing_in_gong(ming_gong_index_);
-        
-        if (zhu_xing.empty()) {
+        if (!gong_has_any_star(ming_gong_index_, ZHENG_YAO_MASK)) {
             return GeJuInfo{
                 .type = GeJuType::MingXiangLiangJia,
                 .name = "命无正曜",
@@ -918,10 +919,10 @@ namespace ZhouYi::ZiWei {
     optional<GeJuInfo> GeJuAnalyzer::check_liang_ji_jia_ming() const {
         auto jia_gong = get_jia_gong_info(ming_gong_index_);
         
-        bool left_has_yang = gong_has_star(jia_gong.left_gong, "擎羊");
-        bool right_has_tuo = gong_has_star(jia_gong.right_gong, "陀罗");
-        bool left_has_tuo = gong_has_star(jia_gong.left_gong, "陀罗");
-        bool right_has_yang = gong_has_star(jia_gong.right_gong, "擎羊");
+        bool left_has_yang = gong_has_star(jia_gong.left_gong, StarId::QingYang);
+        bool right_has_tuo = gong_has_star(jia_gong.right_gong, StarId::TuoLuo);
+        bool left_has_tuo = gong_has_star(jia_gong.left_gong, StarId::TuoLuo);
+        bool right_has_yang = gong_has_star(jia_gong.right_gong, StarId::QingYang);
         
         if ((left_has_yang && right_has_tuo) || (left_has_tuo && right_has_yang)) {
             return GeJuInfo{
@@ -942,9 +943,9 @@ namespace ZhouYi::ZiWei {
         // 化忌被擎羊陀罗夹
         auto jia_gong = get_jia_gong_info(ming_gong_index_);
         
-        bool ming_has_ji = gong_has_star(ming_gong_index_, "化忌");
-        bool left_has_yang_or_tuo = gong_has_any_star(jia_gong.left_gong, {"擎羊", "陀罗"});
-        bool right_has_yang_or_tuo = gong_has_any_star(jia_gong.right_gong, {"擎羊", "陀罗"});
+        bool ming_has_ji = gong_has_star(ming_gong_index_, StarId::HuaJi);
+        bool left_has_yang_or_tuo = gong_has_any_star(jia_gong.left_gong, {StarId::QingYang, StarId::TuoLuo});
+        bool right_has_yang_or_tuo = gong_has_any_star(jia_gong.right_gong, {StarId::QingYang, StarId::TuoLuo});
         
         if (ming_has_ji && left_has_yang_or_tuo && right_has_yang_or_tuo) {
             return GeJuInfo{
@@ -963,14 +964,8 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_si_sha_chong_ming() const {
         // 四煞（擎羊陀罗火星铃星）在三方四正冲照命宫
-        int sha_count = 0;
-        vector<string> si_sha = {"擎羊", "陀罗", "火星", "铃星"};
-        
-        for (const auto& sha : si_sha) {
-            if (san_fang_analyzer_.san_fang_has_star(ming_gong_index_, sha)) {
-                sha_count++;
-            }
-        }
+        constexpr StarMask si_sha{StarId::QingYang, StarId::TuoLuo, StarId::HuoXing, StarId::LingXing};
+        int sha_count = (san_fang_analyzer_.get_san_fang_mask(ming_gong_index_) & si_sha).count();
         
         if (sha_count >= 3) {
             return GeJuInfo{
@@ -979,7 +974,7 @@ namespace ZhouYi::ZiWei {
                 .description = "四煞聚会冲命，劳碌奔波，多灾多难",
                 .is_ji = false,
                 .score = -65,
-                .key_stars = si_sha,
+                .key_stars = {"擎羊", "陀罗", "火星", "铃星"},
                 .key_gongs = {ming_gong_index_}
             };
         }
@@ -989,9 +984,7 @@ namespace ZhouYi::ZiWei {
 
     optional<GeJuInfo> GeJuAnalyzer::check_ming_gong_wu_zhu_xing() const {
         // 与check_ming_xiang_liang_jia类似，但更侧重于无主星的情况
-        auto zhu_xing = get_zhu_xing_in_gong(ming_gong_index_);
-        
-        if (zhu_xing.empty()) {
+        if (!gong_has_any_star(ming_gong_index_, ZHENG_YAO_MASK)) {
             return GeJuInfo{
                 .type = GeJuType::MinggongWuZhuXing,
                 .name = "命宫无主星",
@@ -1015,50 +1008,24 @@ namespace ZhouYi::ZiWei {
         return gong_di_zhi_[fix_index(gong_index)];
     }
 
-    bool GeJuAnalyzer::gong_has_star(int gong_index, const string& star_name) const {
-        const auto& stars = stars_in_gong_[fix_index(gong_index)];
-        return find(stars.begin(), stars.end(), star_name) != stars.end();
+    const StarMask& GeJuAnalyzer::get_gong_mask(int gong_index) const {
+        return san_fang_analyzer_.get_gong_mask(gong_index);
     }
 
-    bool GeJuAnalyzer::gong_has_all_stars(int gong_index, const vector<string>& stars) const {
-        const auto& gong_stars = stars_in_gong_[fix_index(gong_index)];
-        
-        for (const auto& star : stars) {
-            if (find(gong_stars.begin(), gong_stars.end(), star) == gong_stars.end()) {
-                return false;
-            }
-        }
-        
-        return true;
+    bool GeJuAnalyzer::gong_has_star(int gong_index, StarId star) const {
+        return get_gong_mask(gong_index).test(star);
     }
 
-    bool GeJuAnalyzer::gong_has_any_star(int gong_index, const vector<string>& stars) const {
-        const auto& gong_stars = stars_in_gong_[fix_index(gong_index)];
-        
-        for (const auto& star : stars) {
-            if (find(gong_stars.begin(), gong_stars.end(), star) != gong_stars.end()) {
-                return true;
-            }
-        }
-        
-        return false;
+    bool GeJuAnalyzer::gong_has_all_stars(int gong_index, const StarMask& stars) const {
+        return get_gong_mask(gong_index).contains_all(stars);
+    }
+
+    bool GeJuAnalyzer::gong_has_any_star(int gong_index, const StarMask& stars) const {
+        return get_gong_mask(gong_index).contains_any(stars);
     }
 
     vector<string> GeJuAnalyzer::get_zhu_xing_in_gong(int gong_index) const {
-        vector<string> zhu_xing;
-        static const set<string> zheng_yao = {
-            "紫微", "天机", "太阳", "武曲", "天同", "廉贞",
-            "天府", "太阴", "贪狼", "巨门", "天相", "天梁", "七杀", "破军"
-        };
-        
-        const auto& stars = stars_in_gong_[fix_index(gong_index)];
-        for (const auto& star : stars) {
-            if (zheng_yao.find(star) != zheng_yao.end()) {
-                zhu_xing.push_back(star);
-            }
-        }
-        
-        return zhu_xing;
+        return (get_gong_mask(gong_index) & ZHENG_YAO_MASK).to_names();
     }
 
 } // namespace ZhouYi::ZiWei
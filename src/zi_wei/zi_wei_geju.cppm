@@ -5,6 +5,7 @@ import std;
 import ZhouYi.GanZhi;
 import ZhouYi.ZiWei.Constants;
 import ZhouYi.ZiWei.SanFang;
+import ZhouYi.ZiWei.StarMask;
 import ZhouYi.ZhMapper;
 
 export namespace ZhouYi::ZiWei {
@@ -152,6 +153,18 @@ export namespace ZhouYi::ZiWei {
             const array<DiZhi, 12>& gong_di_zhi,
             int ming_gong_index
         );
+
+        /**
+         * @brief 构造函数（直接使用星耀掩码，免去名称解析）
+         * @param gong_masks 每个宫位的星耀掩码
+         * @param gong_di_zhi 每个宫位的地支（从寅宫开始）
+         * @param ming_gong_index 命宫索引
+         */
+        GeJuAnalyzer(
+            const GongStarMasks& gong_masks,
+            const array<DiZhi, 12>& gong_di_zhi,
+            int ming_gong_index
+        );
          
         /**
          * @brief 分析所有格局
@@ -179,10 +192,9 @@ export namespace ZhouYi::ZiWei {
         int get_total_score() const;
         
     private:
-        array<vector<string>, 12> stars_in_gong_;
+        SanFangAnalyzer san_fang_analyzer_;   // 持有各宫及三方四正星耀掩码
         array<DiZhi, 12> gong_di_zhi_;        // 每个宫位的地支
         int ming_gong_index_;
-        SanFangAnalyzer san_fang_analyzer_;
         
         // 富贵格局判断
         optional<GeJuInfo> check_zi_fu_tong_gong() const;
@@ -231,9 +243,10 @@ export namespace ZhouYi::ZiWei {
         
         // 辅助函数
         DiZhi get_gong_di_zhi(int gong_index) const;
-        bool gong_has_star(int gong_index, const string& star_name) const;
-        bool gong_has_all_stars(int gong_index, const vector<string>& stars) const;
-        bool gong_has_any_star(int gong_index, const vector<string>& stars) const;
+        const StarMask& get_gong_mask(int gong_index) const;
+        bool gong_has_star(int gong_index, StarId star) const;
+        bool gong_has_all_stars(int gong_index, const StarMask& stars) const;
+        bool gong_has_any_star(int gong_index, const StarMask& stars) const;
         vector<string> get_zhu_xing_in_gong(int gong_index) const;
     };
 
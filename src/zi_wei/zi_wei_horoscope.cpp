@@ -180,9 +180,7 @@ namespace ZhouYi::ZiWei {
         int ming_index
     ) {
         // 流年地支对应宫位索引（寅0卯1辰2...）
-        int zhi_idx = static_cast<int>(year_zhi);
-        // 转换为从寅宫开始的索引
-        int liu_nian_index = (zhi_idx + 10) % 12;  // 子=10, 丑=11, 寅=0...
+        int liu_nian_index = get_liu_nian_index(year_zhi);
         
         // 获取流年四化
         auto si_hua_map = get_si_hua_table(year_gan);
@@ -220,14 +218,8 @@ namespace ZhouYi::ZiWei {
         DiZhi year_zhi,
         int ming_index
     ) {
-        int year_zhi_idx = static_cast<int>(year_zhi);
-        int liu_nian_index = (year_zhi_idx + 10) % 12;
-        
-        // 从流年宫位逆数到生月
-        int birth_month_index = fix_index(liu_nian_index - (birth_month - 1));
-        
-        // 从生月宫位顺数到当前月
-        int liu_yue_index = fix_index(birth_month_index + (lunar_month - 1));
+        // 从流年宫位逆数到生月，再从生月宫位顺数到当前月
+        int liu_yue_index = get_liu_yue_index(lunar_month, birth_month, year_zhi);
         
         // 获取流月四化
         auto si_hua_map = get_si_hua_table(month_gan);
@@ -262,7 +254,7 @@ namespace ZhouYi::ZiWei {
         int liu_yue_index
     ) {
         // 从流月宫位起初一，顺数到流日
-        int liu_ri_index = fix_index(liu_yue_index + (lunar_day - 1));
+        int liu_ri_index = get_liu_ri_index(lunar_day, liu_yue_index);
         
         // 获取流日四化
         auto si_hua_map = get_si_hua_table(day_gan);
@@ -296,8 +288,7 @@ namespace ZhouYi::ZiWei {
         int liu_ri_index
     ) {
         // 从流日宫位起子时，顺数到流时
-        int hour_idx = static_cast<int>(hour_zhi);
-        int liu_shi_index = fix_index(liu_ri_index + hour_idx);
+        int liu_shi_index = get_liu_shi_index(hour_zhi, liu_ri_index);
         
         // 获取流时四化
         auto si_hua_map = get_si_hua_table(hour_gan);
@@ -320,6 +311,21 @@ namespace ZhouYi::ZiWei {
 
     // ============= 运限流耀星算法 =============
 
+    /**
+     * @brief 获取流耀星所在宫位（魁钺昌曲禄羊陀马鸾喜）
+     */
+    array<int, LIU_YAO_COUNT> get_liu_yao_index(TianGan gan, DiZhi zhi) {
+        auto [kui_idx, yue_idx] = get_kui_yue_index(gan);
+        auto [chang_idx, qu_idx] = get_chang_qu_index(zhi);
+        int lu_idx = get_lu_cun_index(gan);
+        auto [yang_idx, tuo_idx] = get_yang_tuo_index(lu_idx);
+        auto [hong_luan_idx, tian_xi_idx] = get_hong_luan_tian_xi_index(zhi);
+        int ma_idx = get_tian_ma_index(zhi);
+        
+        return {kui_idx, yue_idx, chang_idx, qu_idx, lu_idx,
+                yang_idx, tuo_idx, ma_idx, hong_luan_idx, tian_xi_idx};
+    }
+
     /**
      * @brief 获取运限流耀星（魁钺昌曲禄羊陀马鸾喜）
      * 
@@ -339,23 +345,7 @@ namespace ZhouYi::ZiWei {
         }
         
         // 获取各种星耀的位置
-        auto [kui_idx, yue_idx] = get_kui_yue_index(gan);
-        auto [chang_idx, qu_idx] = get_chang_qu_index(zhi);
-        int lu_idx = get_lu_cun_index(gan);
-        auto [yang_idx, tuo_idx] = get_yang_tuo_index(lu_idx);
-        auto [hong_luan_idx, tian_xi_idx] = get_hong_luan_tian_xi_index(zhi);
-        
-        // 天马索引（按地支）
-        int ma_idx = 0;
-        if (zhi == DiZhi::Yin || zhi == DiZhi::Wu || zhi == DiZhi::Xu) {
-            ma_idx = 6; // 申
-        } else if (zhi == DiZhi::Shen || zhi == DiZhi::Zi || zhi == DiZhi::Chen) {
-            ma_idx = 0; // 寅
-        } else if (zhi == DiZhi::Si || zhi == DiZhi::You || zhi == DiZhi::Chou) {
-            ma_idx = 9; // 亥
-        } else { // 亥卯未
-            ma_idx = 3; // 巳
-        }
+        auto liu_yao = get_liu_yao_index(gan, zhi);
         
         // 根据作用域确定星耀前缀
         string prefix;
@@ -383,16 +373,12 @@ namespace ZhouYi::ZiWei {
         }
         
         // 添加流耀星
-        result[kui_idx].stars.push_back(prefix + "魁");
-        result[yue_idx].stars.push_back(prefix + "钺");
-        result[chang_idx].stars.push_back(prefix + "昌");
-        result[qu_idx].stars.push_back(prefix + "曲");
-        result[lu_idx].stars.push_back(prefix + "禄");
-        result[yang_idx].stars.push_back(prefix + "羊");
-        result[tuo_idx].stars.push_back(prefix + "陀");
-        result[ma_idx].stars.push_back(prefix + "马");
-        result[hong_luan_idx].stars.push_back(prefix + "鸾");
-        result[tian_xi_idx].stars.push_back(prefix + "喜");
+        constexpr array<string_view, LIU_YAO_COUNT> liu_yao_names = {
+            "魁", "钺", "昌", "曲", "禄", "羊", "陀", "马", "鸾", "喜"
+        };
+        for (int i = 0; i < LIU_YAO_COUNT; ++i) {
+            result[liu_yao[i]].stars.push_back(prefix + string(liu_yao_names[i]));
+        }
         
         return result;
     }
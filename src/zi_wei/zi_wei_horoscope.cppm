@@ -214,6 +214,47 @@ export namespace ZhouYi::ZiWei {
         int liu_ri_index
     );
 
+    // ============= 运限宫位索引（不构造名称） =============
+
+    /**
+     * @brief 流年宫位索引：流年以地支定宫
+     */
+    constexpr int get_liu_nian_index(DiZhi year_zhi) {
+        return (static_cast<int>(year_zhi) + 10) % 12;  // 子=10, 丑=11, 寅=0...
+    }
+
+    /**
+     * @brief 流月宫位索引：从流年宫位逆数到生月，再顺数到流月
+     */
+    constexpr int get_liu_yue_index(int lunar_month, int birth_month, DiZhi year_zhi) {
+        int birth_month_index = fix_index(get_liu_nian_index(year_zhi) - (birth_month - 1));
+        return fix_index(birth_month_index + (lunar_month - 1));
+    }
+
+    /**
+     * @brief 流日宫位索引：从流月宫位起初一，顺数到流日
+     */
+    constexpr int get_liu_ri_index(int lunar_day, int liu_yue_index) {
+        return fix_index(liu_yue_index + (lunar_day - 1));
+    }
+
+    /**
+     * @brief 流时宫位索引：从流日宫位起子时，顺数到流时
+     */
+    constexpr int get_liu_shi_index(DiZhi hour_zhi, int liu_ri_index) {
+        return fix_index(liu_ri_index + static_cast<int>(hour_zhi));
+    }
+
+    /**
+     * @brief 流耀星数量（魁钺昌曲禄羊陀马鸾喜）
+     */
+    constexpr int LIU_YAO_COUNT = 10;
+
+    /**
+     * @brief 获取流耀星所在宫位（按魁钺昌曲禄羊陀马鸾喜顺序）
+     */
+    array<int, LIU_YAO_COUNT> get_liu_yao_index(TianGan gan, DiZhi zhi);
+
     /**
      * @brief 获取运限流耀星（魁钺昌曲禄羊陀马鸾喜）
      * 
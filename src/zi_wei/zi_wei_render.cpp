@@ -0,0 +1,331 @@
+// 紫微斗数命盘输出模块（实现）
+module ZhouYi.ZiWei.Render;
+
+import ZhouYi.GanZhi;
+import ZhouYi.ZiWei.Constants;
+import ZhouYi.ZiWei.Palace;
+import ZhouYi.ZiWei.Star;
+import ZhouYi.ZiWei.StarMask;
+import ZhouYi.ZiWei.Horoscope;
+import ZhouYi.ZiWei.Chart;
+import ZhouYi.ZiWei;
+import ZhouYi.ZhMapper;
+import fmt;
+import std;
+
+namespace ZhouYi::ZiWei {
+    using namespace std;
+    using namespace ZhouYi::GanZhi;
+    using namespace ZhouYi::Mapper;
+
+    namespace {
+        constexpr string_view RULE = "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+
+        void append(fmt::memory_buffer& out, string_view text) {
+            out.append(text.data(), text.data() + text.size());
+        }
+
+        // ============= 文本 =============
+
+        void render_star_text(fmt::memory_buffer& out, string_view name, LiangDu liang_du, optional<SiHua> si_hua) {
+            fmt::format_to(fmt::appender(out), "{} [{}]", name, to_zh(liang_du));
+            if (si_hua.has_value()) {
+                fmt::format_to(fmt::appender(out), " {}", to_zh(*si_hua));
+            }
+        }
+
+        void render_gong_text(fmt::memory_buffer& out, GongWei gong_wei, TianGan tian_gan, DiZhi di_zhi) {
+            fmt::format_to(fmt::appender(out), "{} ({}{})", to_zh(gong_wei), to_zh(tian_gan), to_zh(di_zhi));
+        }
+
+        void render_star_list_text(fmt::memory_buffer& out, string_view title, const vector<StarData>& stars) {
+            if (stars.empty()) {
+                return;
+            }
+            append(out, title);
+            for (const auto& star : stars) {
+                render_text(out, star);
+                out.push_back(' ');
+            }
+        }
+
+        /**
+         * @brief 紧凑宫位中一类星耀（按 StarId 区间）的文本
+         */
+        void render_chart_stars_text(fmt::memory_buffer& out, string_view title, const ChartPalace& palace,
+                                     StarId begin, StarId end) {
+            bool first = true;
+            for (const auto& star : palace.get_stars()) {
+                if (star.id < begin || star.id >= end) {
+                    continue;
+                }
+                if (first) {
+                    append(out, title);
+                    first = false;
+                }
+                render_star_text(out, star.get_name(), star.get_liang_du(), star.get_si_hua());
+                out.push_back(' ');
+            }
+        }
+
+        // ============= JSON =============
+
+        /**
+         * @brief 写入 JSON 字符串（含引号与必要的转义）
+         */
+        void json_string(fmt::memory_buffer& out, string_view text) {
+            out.push_back('"');
+            for (char c : text) {
+                switch (c) {
+                    case '"': append(out, "\\\""); break;
+                    case '\\': append(out, "\\\\"); break;
+                    case '\n': append(out, "\\n"); break;
+                    case '\r': append(out, "\\r"); break;
+                    case '\t': append(out, "\\t"); break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20) {
+                            fmt::format_to(fmt::appender(out), "\\u{:04x}", static_cast<unsigned>(c));
+                        } else {
+                            out.push_back(c);
+                        }
+                }
+            }
+            out.push_back('"');
+        }
+
+        void json_key(fmt::memory_buffer& out, string_view key) {
+            json_string(out, key);
+            out.push_back(':');
+        }
+
+        void json_bool(fmt::memory_buffer& out, bool value) {
+            append(out, value ? "true" : "false");
+        }
+
+        void json_gong_fields(fmt::memory_buffer& out, GongWei gong_wei, TianGan tian_gan, DiZhi di_zhi,
+                              bool is_ming_palace, bool is_body_palace) {
+            json_key(out, "name");
+            json_string(out, to_zh(gong_wei));
+            append(out, ",\"gan_zhi\":\"");
+            append(out, to_zh(tian_gan));
+            append(out, to_zh(di_zhi));
+            append(out, "\",\"is_ming_palace\":");
+            json_bool(out, is_ming_palace);
+            append(out, ",\"is_body_palace\":");
+            json_bool(out, is_body_palace);
+        }
+
+        void json_zhu_xing(fmt::memory_buffer& out, string_view name, LiangDu liang_du, optional<SiHua> si_hua) {
+            append(out, "{\"name\":");
+            json_string(out, name);
+            append(out, ",\"liang_du\":");
+            json_string(out, to_zh(liang_du));
+            if (si_hua.has_value()) {
+                append(out, ",\"si_hua\":");
+                json_string(out, to_zh(*si_hua));
+            }
+            out.push_back('}');
+        }
+    }
+
+    // ============= 文本输出 =============
+
+    void render_text(fmt::memory_buffer& out, const StarData& star) {
+        render_star_text(out, star.name, star.liang_du, star.si_hua);
+    }
+
+    void render_text(fmt::memory_buffer& out, const GongWeiData& gong_data) {
+        render_gong_text(out, gong_data.gong_wei, gong_data.tian_gan, gong_data.di_zhi);
+    }
+
+    void render_text(fmt::memory_buffer& out, const PalaceInfo& palace) {
+        append(out, "【");
+        render_text(out, palace.gong_data);
+        append(out, "】");
+        render_star_list_text(out, "\n  主星：", palace.zhu_xing);
+        render_star_list_text(out, "\n  辅星：", palace.fu_xing);
+        render_star_list_text(out, "\n  煞星：", palace.sha_xing);
+    }
+
+    void render_text(fmt::memory_buffer& out, const DaXianData& da_xian) {
+        fmt::format_to(fmt::appender(out), "大限 {}~{} 岁 [{}-{}宫] 四化: {}",
+            da_xian.start_age, da_xian.end_age,
+            to_zh(da_xian.tian_gan), to_zh(da_xian.di_zhi),
+            fmt::join(da_xian.si_hua, " "));
+    }
+
+    void render_text(fmt::memory_buffer& out, const ZiWeiResult& result) {
+        append(out, RULE);
+        append(out, "           紫微斗数命盘\n");
+        append(out, RULE);
+        out.push_back('\n');
+
+        const auto& ming = result.palaces[result.ming_gong_index].gong_data;
+        const auto& shen = result.palaces[result.shen_gong_index].gong_data;
+        auto it = fmt::appender(out);
+        it = fmt::format_to(it, "阳历：{}\n", result.solar_day.to_string());
+        it = fmt::format_to(it, "农历：{} {}\n", result.lunar_day.to_string(), result.lunar_hour.to_string());
+        it = fmt::format_to(it, "性别：{}\n", result.is_male ? "男" : "女");
+        it = fmt::format_to(it, "四柱：{}{} {}{} {}{} {}{}\n",
+            to_zh(result.year_pillar.gan), to_zh(result.year_pillar.zhi),
+            to_zh(result.month_pillar.gan), to_zh(result.month_pillar.zhi),
+            to_zh(result.day_pillar.gan), to_zh(result.day_pillar.zhi),
+            to_zh(result.hour_pillar.gan), to_zh(result.hour_pillar.zhi));
+        it = fmt::format_to(it, "五行局：{}\n", to_zh(result.wu_xing_ju));
+        it = fmt::format_to(it, "命宫：{}{}\n", to_zh(ming.tian_gan), to_zh(ming.di_zhi));
+        fmt::format_to(it, "身宫：{}{}\n\n", to_zh(shen.tian_gan), to_zh(shen.di_zhi));
+
+        append(out, RULE);
+        append(out, "           十二宫详情\n");
+        append(out, RULE);
+        out.push_back('\n');
+
+        for (const auto& palace : result.palaces) {
+            render_text(out, palace);
+            append(out, "\n\n");
+        }
+    }
+
+    void render_text(fmt::memory_buffer& out, const ZiWeiChart& chart) {
+        const auto& ming = chart.palaces[chart.ming_gong_index];
+        const auto& shen = chart.palaces[chart.shen_gong_index];
+        auto it = fmt::appender(out);
+        it = fmt::format_to(it, "五行局：{}\n", to_zh(chart.wu_xing_ju));
+        it = fmt::format_to(it, "命宫：{}{}\n", to_zh(ming.tian_gan), to_zh(ming.di_zhi));
+        fmt::format_to(it, "身宫：{}{}\n\n", to_zh(shen.tian_gan), to_zh(shen.di_zhi));
+
+        for (const auto& palace : chart.palaces) {
+            append(out, "【");
+            render_gong_text(out, palace.gong_wei, palace.tian_gan, palace.di_zhi);
+            append(out, "】");
+            render_chart_stars_text(out, "\n  主星：", palace, StarId::ZiWei, StarId::ZuoFu);
+            render_chart_stars_text(out, "\n  辅星：", palace, StarId::ZuoFu, StarId::QingYang);
+            render_chart_stars_text(out, "\n  煞星：", palace, StarId::QingYang, StarId::COUNT);
+            append(out, "\n\n");
+        }
+    }
+
+    // ============= JSON 输出 =============
+
+    void render_json(fmt::memory_buffer& out, const ZiWeiResult& result) {
+        auto it = fmt::appender(out);
+        out.push_back('{');
+        json_key(out, "solar_date");
+        json_string(out, result.solar_day.to_string());
+        append(out, ",\"lunar_date\":");
+        json_string(out, result.lunar_day.to_string());
+        append(out, ",\"lunar_hour\":");
+        json_string(out, result.lunar_hour.to_string());
+        append(out, ",\"gender\":");
+        json_string(out, result.is_male ? "男" : "女");
+
+        fmt::format_to(it, ",\"si_zhu\":{{\"year\":\"{}{}\",\"month\":\"{}{}\",\"day\":\"{}{}\",\"hour\":\"{}{}\"}}",
+            to_zh(result.year_pillar.gan), to_zh(result.year_pillar.zhi),
+            to_zh(result.month_pillar.gan), to_zh(result.month_pillar.zhi),
+            to_zh(result.day_pillar.gan), to_zh(result.day_pillar.zhi),
+            to_zh(result.hour_pillar.gan), to_zh(result.hour_pillar.zhi));
+
+        append(out, ",\"wu_xing_ju\":");
+        json_string(out, to_zh(result.wu_xing_ju));
+        fmt::format_to(it, ",\"ming_gong_index\":{},\"shen_gong_index\":{}",
+            result.ming_gong_index, result.shen_gong_index);
+
+        append(out, ",\"palaces\":[");
+        for (size_t i = 0; i < result.palaces.size(); ++i) {
+            const auto& palace = result.palaces[i];
+            const auto& gong = palace.gong_data;
+            append(out, i == 0 ? "{" : ",{");
+            json_gong_fields(out, gong.gong_wei, gong.tian_gan, gong.di_zhi, gong.is_ming_palace, gong.is_body_palace);
+
+            append(out, ",\"zhu_xing\":[");
+            for (size_t s = 0; s < palace.zhu_xing.size(); ++s) {
+                if (s > 0) {
+                    out.push_back(',');
+                }
+                const auto& star = palace.zhu_xing[s];
+                json_zhu_xing(out, star.name, star.liang_du, star.si_hua);
+            }
+            append(out, "],\"fu_xing\":[");
+            for (size_t s = 0; s < palace.fu_xing.size(); ++s) {
+                if (s > 0) {
+                    out.push_back(',');
+                }
+                json_string(out, palace.fu_xing[s].name);
+            }
+            append(out, "],\"sha_xing\":[");
+            for (size_t s = 0; s < palace.sha_xing.size(); ++s) {
+                if (s > 0) {
+                    out.push_back(',');
+                }
+                json_string(out, palace.sha_xing[s].name);
+            }
+            append(out, "]}");
+        }
+
+        append(out, "],\"da_xian\":[");
+        for (size_t i = 0; i < result.da_xian_data.size(); ++i) {
+            const auto& da_xian = result.da_xian_data[i];
+            fmt::format_to(it, "{}{{\"start_age\":{},\"end_age\":{},\"gong_index\":{},\"gan_zhi\":\"{}{}\",\"si_hua\":[",
+                i == 0 ? "" : ",", da_xian.start_age, da_xian.end_age, da_xian.gong_index,
+                to_zh(da_xian.tian_gan), to_zh(da_xian.di_zhi));
+            for (size_t h = 0; h < da_xian.si_hua.size(); ++h) {
+                if (h > 0) {
+                    out.push_back(',');
+                }
+                json_string(out, da_xian.si_hua[h]);
+            }
+            append(out, "]}");
+        }
+        append(out, "]}");
+    }
+
+    void render_json(fmt::memory_buffer& out, const ZiWeiChart& chart) {
+        fmt::format_to(fmt::appender(out), "{{\"wu_xing_ju\":\"{}\",\"ming_gong_index\":{},\"shen_gong_index\":{},\"palaces\":[",
+            to_zh(chart.wu_xing_ju), chart.ming_gong_index, chart.shen_gong_index);
+
+        for (int i = 0; i < 12; ++i) {
+            const auto& palace = chart.palaces[i];
+            append(out, i == 0 ? "{" : ",{");
+            json_gong_fields(out, palace.gong_wei, palace.tian_gan, palace.di_zhi,
+                i == chart.ming_gong_index, i == chart.shen_gong_index);
+
+            // 星耀按编号排列：主星在前，辅星、煞星随后
+            append(out, ",\"zhu_xing\":[");
+            bool first = true;
+            for (const auto& star : palace.get_stars()) {
+                if (star.id < StarId::ZuoFu) {
+                    if (!first) {
+                        out.push_back(',');
+                    }
+                    json_zhu_xing(out, star.get_name(), star.get_liang_du(), star.get_si_hua());
+                    first = false;
+                }
+            }
+            append(out, "],\"fu_xing\":[");
+            first = true;
+            for (const auto& star : palace.get_stars()) {
+                if (star.id >= StarId::ZuoFu && star.id < StarId::QingYang) {
+                    if (!first) {
+                        out.push_back(',');
+                    }
+                    json_string(out, star.get_name());
+                    first = false;
+                }
+            }
+            append(out, "],\"sha_xing\":[");
+            first = true;
+            for (const auto& star : palace.get_stars()) {
+                if (star.id >= StarId::QingYang) {
+                    if (!first) {
+                        out.push_back(',');
+                    }
+                    json_string(out, star.get_name());
+                    first = false;
+                }
+            }
+            append(out, "]}");
+        }
+        append(out, "]}");
+    }
+
+} // namespace ZhouYi::ZiWei
@@ -0,0 +1,50 @@
+// 紫微斗数命盘输出模块（接口）
+export module ZhouYi.ZiWei.Render;
+
+import std;
+import ZhouYi.ZiWei.Palace;
+import ZhouYi.ZiWei.Star;
+import ZhouYi.ZiWei.Horoscope;
+import ZhouYi.ZiWei.Chart;
+import ZhouYi.ZiWei;
+import fmt;
+
+export namespace ZhouYi::ZiWei {
+    using namespace std;
+
+    /**
+     * 命盘输出直接追加到调用方提供的 fmt::memory_buffer：
+     * 名称均取自 ZhMap 的 string_view 常量表，不为每颗星生成临时字符串。
+     * 缓冲区可跨请求复用（clear() 后保留容量），输出不含结尾的 '\0'。
+     *
+     * 文本格式与对应的 to_string() 逐字一致。
+     */
+
+    void render_text(fmt::memory_buffer& out, const StarData& star);
+
+    void render_text(fmt::memory_buffer& out, const GongWeiData& gong_data);
+
+    void render_text(fmt::memory_buffer& out, const PalaceInfo& palace);
+
+    void render_text(fmt::memory_buffer& out, const DaXianData& da_xian);
+
+    void render_text(fmt::memory_buffer& out, const ZiWeiResult& result);
+
+    /**
+     * @brief 紧凑命盘的文本输出（只含命盘本身，无历法信息）
+     */
+    void render_text(fmt::memory_buffer& out, const ZiWeiChart& chart);
+
+    /**
+     * @brief 命盘 JSON 输出（紧凑格式）
+     *
+     * 字段与 export_to_json 相同，另附大限数据；不经过 nlohmann::json 的中间对象。
+     */
+    void render_json(fmt::memory_buffer& out, const ZiWeiResult& result);
+
+    /**
+     * @brief 紧凑命盘的 JSON 输出（紧凑格式）
+     */
+    void render_json(fmt::memory_buffer& out, const ZiWeiChart& chart);
+
+} // namespace ZhouYi::ZiWei
@@ -2,6 +2,7 @@
 module ZhouYi.ZiWei.SanFang;
 
 import ZhouYi.ZiWei.Constants;
+import ZhouYi.ZiWei.StarMask;
 import fmt;
 import std;
 import ZhouYi.ZhMapper;
@@ -95,8 +96,45 @@ namespace ZhouYi::ZiWei {
 
     // ============= SanFangAnalyzer 实现 =============
 
+    namespace {
+        /**
+         * @brief 名称列表全部可编码时返回掩码，否则返回 nullopt（回退字符串查找）
+         */
+        optional<StarMask> to_known_mask(const vector<string>& names) {
+            StarMask mask;
+            for (const auto& name : names) {
+                auto id = star_id_from_name(name);
+                if (!id.has_value()) {
+                    return nullopt;
+                }
+                mask.set(*id);
+            }
+            return mask;
+        }
+    }
+
     SanFangAnalyzer::SanFangAnalyzer(const array<vector<string>, 12>& stars_in_gong)
-        : stars_in_gong_(stars_in_gong) {}
+        : stars_in_gong_(stars_in_gong),
+          gong_masks_(to_gong_star_masks(stars_in_gong)) {
+        build_san_fang_masks();
+    }
+
+    SanFangAnalyzer::SanFangAnalyzer(const GongStarMasks& gong_masks)
+        : gong_masks_(gong_masks) {
+        for (int i = 0; i < 12; ++i) {
+            stars_in_gong_[i] = gong_masks_[i].to_names();
+        }
+        build_san_fang_masks();
+    }
+
+    void SanFangAnalyzer::build_san_fang_masks() {
+        for (int i = 0; i < 12; ++i) {
+            san_fang_masks_[i] = gong_masks_[i]
+                | gong_masks_[fix_index(i + 6)]
+                | gong_masks_[fix_index(i + 8)]
+                | gong_masks_[fix_index(i + 4)];
+        }
+    }
 
     vector<string> SanFangAnalyzer::get_san_fang_stars(int gong_index) const {
         auto san_fang = get_san_fang_si_zheng(gong_index);
@@ -111,11 +149,17 @@ namespace ZhouYi::ZiWei {
     }
 
     bool SanFangAnalyzer::san_fang_has_star(int gong_index, const string& star_name) const {
+        if (auto id = star_id_from_name(star_name); id.has_value()) {
+            return san_fang_has_star(gong_index, *id);
+        }
         auto san_fang_stars = get_san_fang_stars(gong_index);
         return find(san_fang_stars.begin(), san_fang_stars.end(), star_name) != san_fang_stars.end();
     }
 
     bool SanFangAnalyzer::san_fang_has_all_stars(int gong_index, const vector<string>& star_names) const {
+        if (auto mask = to_known_mask(star_names); mask.has_value()) {
+            return san_fang_has_all_stars(gong_index, *mask);
+        }
         auto san_fang_stars = get_san_fang_stars(gong_index);
         
         for (const auto& star : star_names) {
@@ -128,6 +172,9 @@ namespace ZhouYi::ZiWei {
     }
 
     bool SanFangAnalyzer::san_fang_has_any_star(int gong_index, const vector<string>& star_names) const {
+        if (auto mask = to_known_mask(star_names); mask.has_value()) {
+            return san_fang_has_any_star(gong_index, *mask);
+        }
         auto san_fang_stars = get_san_fang_stars(gong_index);
         
         for (const auto& star : star_names) {
@@ -156,69 +203,25 @@ namespace ZhouYi::ZiWei {
 
     bool SanFangAnalyzer::is_ji_xing_jia(int gong_index) const {
         auto jia_gong = get_jia_gong_info(gong_index);
-        const auto& left_stars = stars_in_gong_[jia_gong.left_gong];
-        const auto& right_stars = stars_in_gong_[jia_gong.right_gong];
-        
-        // 吉星列表
-        static const set<string> ji_xing = {
-            "左辅", "右弼", "文昌", "文曲", "天魁", "天钺", "禄存"
-        };
-        
-        bool left_is_ji = false;
-        bool right_is_ji = false;
-        
-        for (const auto& star : left_stars) {
-            if (ji_xing.find(star) != ji_xing.end()) {
-                left_is_ji = true;
-                break;
-            }
-        }
         
-        for (const auto& star : right_stars) {
-            if (ji_xing.find(star) != ji_xing.end()) {
-                right_is_ji = true;
-                break;
-            }
-        }
-        
-        return left_is_ji && right_is_ji;  // 左右都有吉星才算夹
+        // 左右都有吉星才算夹
+        return gong_masks_[jia_gong.left_gong].contains_any(JI_XING_MASK) &&
+               gong_masks_[jia_gong.right_gong].contains_any(JI_XING_MASK);
     }
 
     bool SanFangAnalyzer::is_sha_xing_jia(int gong_index) const {
         auto jia_gong = get_jia_gong_info(gong_index);
-        const auto& left_stars = stars_in_gong_[jia_gong.left_gong];
-        const auto& right_stars = stars_in_gong_[jia_gong.right_gong];
-        
-        // 煞星列表
-        static const set<string> sha_xing = {
-            "擎羊", "陀罗", "火星", "铃星", "地空", "地劫"
-        };
-        
-        bool left_is_sha = false;
-        bool right_is_sha = false;
-        
-        for (const auto& star : left_stars) {
-            if (sha_xing.find(star) != sha_xing.end()) {
-                left_is_sha = true;
-                break;
-            }
-        }
-        
-        for (const auto& star : right_stars) {
-            if (sha_xing.find(star) != sha_xing.end()) {
-                right_is_sha = true;
-                break;
-            }
-        }
         
-        return left_is_sha && right_is_sha;  // 左右都有煞星才算夹
+        // 左右都有煞星才算夹
+        return gong_masks_[jia_gong.left_gong].contains_any(SHA_XING_MASK) &&
+               gong_masks_[jia_gong.right_gong].contains_any(SHA_XING_MASK);
     }
 
     vector<KongGongInfo> SanFangAnalyzer::get_all_kong_gong() const {
         vector<KongGongInfo> result;
         
         for (int i = 0; i < 12; ++i) {
-            if (is_kong_gong(stars_in_gong_[i])) {
+            if (!gong_masks_[i].contains_any(ZHENG_YAO_MASK)) {
                 int dui_gong = fix_index(i + 6);
                 auto kong_info = get_jie_xing_info(i, stars_in_gong_[dui_gong]);
                 result.push_back(kong_info);
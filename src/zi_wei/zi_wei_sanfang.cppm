@@ -3,6 +3,7 @@ export module ZhouYi.ZiWei.SanFang;
 
 import std;
 import ZhouYi.ZiWei.Constants;
+import ZhouYi.ZiWei.StarMask;
 import ZhouYi.ZhMapper;
 
 export namespace ZhouYi::ZiWei {
@@ -106,6 +107,9 @@ export namespace ZhouYi::ZiWei {
 
     /**
      * @brief 三方四正分析器
+     *
+     * 构造时把每宫星耀折叠为 StarMask，并预先合并各宫三方四正的掩码，
+     * 之后的查询只做按位运算。
      */
     class SanFangAnalyzer {
     public:
@@ -114,6 +118,26 @@ export namespace ZhouYi::ZiWei {
          * @param stars_in_gong 每个宫位的所有星耀
          */
         SanFangAnalyzer(const array<vector<string>, 12>& stars_in_gong);
+
+        /**
+         * @brief 构造函数
+         * @param gong_masks 每个宫位的星耀掩码
+         */
+        explicit SanFangAnalyzer(const GongStarMasks& gong_masks);
+
+        /**
+         * @brief 获取某宫的星耀掩码
+         */
+        const StarMask& get_gong_mask(int gong_index) const {
+            return gong_masks_[fix_index(gong_index)];
+        }
+
+        /**
+         * @brief 获取某宫三方四正合并后的星耀掩码
+         */
+        const StarMask& get_san_fang_mask(int gong_index) const {
+            return san_fang_masks_[fix_index(gong_index)];
+        }
         
         /**
          * @brief 获取三方四正的所有星耀
@@ -134,6 +158,18 @@ export namespace ZhouYi::ZiWei {
          * @brief 判断三方四正是否有某些星（满足其一）
          */
         bool san_fang_has_any_star(int gong_index, const vector<string>& star_names) const;
+
+        bool san_fang_has_star(int gong_index, StarId star) const {
+            return get_san_fang_mask(gong_index).test(star);
+        }
+
+        bool san_fang_has_all_stars(int gong_index, const StarMask& stars) const {
+            return get_san_fang_mask(gong_index).contains_all(stars);
+        }
+
+        bool san_fang_has_any_star(int gong_index, const StarMask& stars) const {
+            return get_san_fang_mask(gong_index).contains_any(stars);
+        }
         
         /**
          * @brief 获取夹某宫的星耀
@@ -157,6 +193,10 @@ export namespace ZhouYi::ZiWei {
         
     private:
         array<vector<string>, 12> stars_in_gong_;
+        GongStarMasks gong_masks_;
+        GongStarMasks san_fang_masks_;  // 本宫、对宫、三合宫掩码之并
+
+        void build_san_fang_masks();
         
         /**
          * @brief 判断是否为主星
@@ -147,11 +147,23 @@ namespace ZhouYi::ZiWei {
         const array<vector<string>, 12>& stars_in_gong
     ) : stars_in_gong_(stars_in_gong) {
         calculate_gong_gan_si_hua(gong_gan_zhi);
+        calculate_fei_hua_paths();
     }
 
     void SiHuaSystem::calculate_gong_gan_si_hua(
         const array<pair<TianGan, DiZhi>, 12>& gong_gan_zhi
     ) {
+        // 先定各主星所在宫，避免每次按名称扫描十二宫
+        array<int, static_cast<int>(ZhuXing::COUNT)> star_gong;
+        star_gong.fill(-1);
+        for (int j = 11; j >= 0; --j) {
+            for (const auto& name : stars_in_gong_[j]) {
+                if (auto star = from_zh<ZhuXing>(name); star.has_value() && *star != ZhuXing::COUNT) {
+                    star_gong[static_cast<int>(*star)] = j;
+                }
+            }
+        }
+
         for (int i = 0; i < 12; ++i) {
             auto [gan, zhi] = gong_gan_zhi[i];
             gong_gan_si_hua_[i].gong_index = i;
@@ -174,20 +186,10 @@ namespace ZhouYi::ZiWei {
                 auto star = si_hua_stars[si_hua_idx].value();
                 string star_name = string(to_zh(star));
                 
-                // 在12个宫位中查找该星
-                int star_gong = -1;
-                for (int j = 0; j < 12; ++j) {
-                    if (find(stars_in_gong_[j].begin(), stars_in_gong_[j].end(), star_name) 
-                        != stars_in_gong_[j].end()) {
-                        star_gong = j;
-                        break;
-                    }
-                }
-                
                 gong_gan_si_hua_[i].si_hua_list[si_hua_idx] = SiHuaInfo{
                     .type = static_cast<SiHua>(si_hua_idx),
                     .star_name = star_name,
-                    .gong_index = star_gong
+                    .gong_index = star_gong[static_cast<int>(star)]
                 };
             }
         }
@@ -246,15 +248,7 @@ namespace ZhouYi::ZiWei {
         from_gong = fix_index(from_gong);
         to_gong = fix_index(to_gong);
         
-        const auto& gong_si_hua = gong_gan_si_hua_[from_gong];
-        
-        for (const auto& si_hua : gong_si_hua.si_hua_list) {
-            if (si_hua.type == si_hua_type && si_hua.gong_index == to_gong) {
-                return true;
-            }
-        }
-        
-        return false;
+        return fei_hua_to_[static_cast<int>(si_hua_type)][from_gong] == to_gong;
     }
 
     vector<FeiHuaRelation> SiHuaSystem::get_fei_hua_from(int gong_index) const {
@@ -301,85 +295,90 @@ namespace ZhouYi::ZiWei {
         return result;
     }
 
+    void SiHuaSystem::calculate_fei_hua_paths() {
+        // 邻接表：某宫某化若有落宫则记录，否则为 -1
+        for (int type = 0; type < 4; ++type) {
+            for (int from = 0; from < 12; ++from) {
+                const auto& si_hua = gong_gan_si_hua_[from].si_hua_list[type];
+                bool lands = si_hua.gong_index >= 0 && !si_hua.star_name.empty();
+                fei_hua_to_[type][from] = static_cast<int8_t>(lands ? si_hua.gong_index : -1);
+            }
+        }
+
+        // 每宫每化的出边唯一，沿出边走至多4层；回本宫或落入已访问宫即止
+        for (int type = 0; type < 4; ++type) {
+            for (int start = 0; start < 12; ++start) {
+                FeiHuaPath path{.gongs = {-1, -1, -1, -1}, .depth = 0, .is_hui_ben = false};
+                uint16_t visited = 0;
+                int current = start;
+
+                while (path.depth < 4) {
+                    int to = fei_hua_to_[type][current];
+                    if (to < 0) {
+                        break;
+                    }
+                    path.gongs[path.depth++] = static_cast<int8_t>(to);
+                    if (to == start) {
+                        path.is_hui_ben = true;
+                        break;
+                    }
+                    if (visited & (1u << to)) {
+                        break;
+                    }
+                    visited |= static_cast<uint16_t>(1u << to);
+                    current = to;
+                }
+
+                fei_hua_paths_[type][start] = path;
+            }
+        }
+    }
+
+    FeiHuaRelation SiHuaSystem::make_relation(int from_gong, SiHua si_hua_type) const {
+        const auto& gong_si_hua = gong_gan_si_hua_[from_gong];
+        return FeiHuaRelation{
+            .from_gong = from_gong,
+            .from_gan = gong_si_hua.gong_gan,
+            .to_gong = fei_hua_to_[static_cast<int>(si_hua_type)][from_gong],
+            .si_hua_type = si_hua_type,
+            .star_name = gong_si_hua.si_hua_list[static_cast<int>(si_hua_type)].star_name
+        };
+    }
+
     vector<FeiHuaChain> SiHuaSystem::get_fei_hua_chains(
         int start_gong,
         SiHua si_hua_type,
         int max_depth
     ) const {
-        vector<FeiHuaChain> result;
-        vector<FeiHuaRelation> current_chain;
-        set<int> visited;
-        
-        max_depth = min(max_depth, 4);  // 最多4层
+        start_gong = fix_index(start_gong);
+        const auto& path = get_fei_hua_path(start_gong, si_hua_type);
         
-        find_chains_recursive(start_gong, si_hua_type, 0, max_depth, current_chain, visited, result);
+        max_depth = min({max_depth, 4, static_cast<int>(path.depth)});  // 最多4层
         
-        return result;
-    }
-
-    void SiHuaSystem::find_chains_recursive(
-        int current_gong,
-        SiHua si_hua_type,
-        int current_depth,
-        int max_depth,
-        vector<FeiHuaRelation>& current_chain,
-        set<int>& visited,
-        vector<FeiHuaChain>& result
-    ) const {
-        if (current_depth >= max_depth) {
-            return;
+        // 飞化链即路径的各层前缀，只有末层可能回本宫
+        vector<FeiHuaChain> result;
+        vector<FeiHuaRelation> current_chain;
+        for (int depth = 0; depth < max_depth; ++depth) {
+            int from_gong = depth == 0 ? start_gong : path.gongs[depth - 1];
+            current_chain.push_back(make_relation(from_gong, si_hua_type));
+            result.push_back(FeiHuaChain{
+                .chain = current_chain,
+                .is_hui_ben = path.is_hui_ben && depth + 1 == path.depth
+            });
         }
         
-        const auto& gong_si_hua = gong_gan_si_hua_[current_gong];
-        
-        // 查找指定类型的四化
-        for (const auto& si_hua : gong_si_hua.si_hua_list) {
-            if (si_hua.type == si_hua_type && si_hua.gong_index >= 0 && !si_hua.star_name.empty()) {
-                FeiHuaRelation relation{
-                    .from_gong = current_gong,
-                    .from_gan = gong_si_hua.gong_gan,
-                    .to_gong = si_hua.gong_index,
-                    .si_hua_type = si_hua_type,
-                    .star_name = si_hua.star_name
-                };
-                
-                current_chain.push_back(relation);
-                
-                // 检查是否回到起始宫
-                bool is_hui_ben = false;
-                if (!current_chain.empty() && si_hua.gong_index == current_chain[0].from_gong) {
-                    is_hui_ben = true;
-                }
-                
-                // 保存当前链
-                result.push_back(FeiHuaChain{
-                    .chain = current_chain,
-                    .is_hui_ben = is_hui_ben
-                });
-                
-                // 如果没有回本宫且没有访问过，继续递归
-                if (!is_hui_ben && visited.find(si_hua.gong_index) == visited.end()) {
-                    visited.insert(si_hua.gong_index);
-                    find_chains_recursive(si_hua.gong_index, si_hua_type, current_depth + 1, 
-                                         max_depth, current_chain, visited, result);
-                    visited.erase(si_hua.gong_index);
-                }
-                
-                current_chain.pop_back();
-            }
-        }
+        return result;
     }
 
     vector<FeiHuaChain> SiHuaSystem::find_hui_ben_chains(int start_gong) const {
         vector<FeiHuaChain> all_chains;
         
-        // 对每种四化类型查找回本宫的链
+        // 对每种四化类型查表，仅回本宫的路径需要展开
         for (int i = 0; i < 4; ++i) {
-            auto chains = get_fei_hua_chains(start_gong, static_cast<SiHua>(i), 4);
-            for (const auto& chain : chains) {
-                if (chain.is_hui_ben) {
-                    all_chains.push_back(chain);
-                }
+            auto type = static_cast<SiHua>(i);
+            const auto& path = get_fei_hua_path(start_gong, type);
+            if (path.is_hui_ben) {
+                all_chains.push_back(get_fei_hua_chains(start_gong, type, 4).back());
             }
         }
         
@@ -93,8 +93,22 @@ export namespace ZhouYi::ZiWei {
         string to_string() const;
     };
 
+    /**
+     * @brief 单一四化类型下从某宫出发的飞化路径
+     *
+     * 同一宫干的某一化只落一宫，飞化链即沿此路径的各层前缀。
+     */
+    struct FeiHuaPath {
+        array<int8_t, 4> gongs;  // 第1~4层落宫
+        uint8_t depth;           // 路径层数（0表示该化不落宫）
+        bool is_hui_ben;         // 末层是否飞回起始宫
+    };
+
     /**
      * @brief 四化系统管理器
+     *
+     * 构造时建立 4×12 飞化邻接表，并一次性求出每宫每化最多4层的飞化路径，
+     * 飞化链与回本宫查询均直接查表。
      */
     class SiHuaSystem {
     public:
@@ -168,28 +182,34 @@ export namespace ZhouYi::ZiWei {
          * @brief 查找飞化回本宫的链（四化回本宫）
          */
         vector<FeiHuaChain> find_hui_ben_chains(int start_gong) const;
+
+        /**
+         * @brief 获取预计算的飞化路径（不分配内存）
+         */
+        const FeiHuaPath& get_fei_hua_path(int start_gong, SiHua si_hua_type) const {
+            return fei_hua_paths_[static_cast<int>(si_hua_type)][fix_index(start_gong)];
+        }
         
     private:
         array<GongGanSiHua, 12> gong_gan_si_hua_;     // 12宫的宫干四化
         array<vector<string>, 12> stars_in_gong_;     // 每宫的星耀列表
+        array<array<int8_t, 12>, 4> fei_hua_to_;      // 飞化邻接表 [四化][起飞宫] -> 落宫（-1 表示不落宫）
+        array<array<FeiHuaPath, 12>, 4> fei_hua_paths_; // 飞化路径 [四化][起始宫]
         
         /**
          * @brief 计算宫干四化
          */
         void calculate_gong_gan_si_hua(const array<pair<TianGan, DiZhi>, 12>& gong_gan_zhi);
-        
+
         /**
-         * @brief 递归查找飞化链
+         * @brief 由邻接表迭代求出全部飞化路径
          */
-        void find_chains_recursive(
-            int current_gong,
-            SiHua si_hua_type,
-            int current_depth,
-            int max_depth,
-            vector<FeiHuaRelation>& current_chain,
-            set<int>& visited,
-            vector<FeiHuaChain>& result
-        ) const;
+        void calculate_fei_hua_paths();
+
+        /**
+         * @brief 构造单层飞化关系
+         */
+        FeiHuaRelation make_relation(int from_gong, SiHua si_hua_type) const;
     };
 
     /**
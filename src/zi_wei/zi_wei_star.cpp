@@ -66,6 +66,42 @@ namespace ZhouYi::ZiWei {
         return zi_wei_index;
     }
 
+    /**
+     * @brief 安紫微诸星诀
+     * 
+     * 口诀：
+     * 紫微逆去天机星，隔一太阳武曲辰，
+     * 连接天同空二宫，廉贞居处方是真。
+     * 
+     * 排列：紫微 → 天机(逆1) → 空 → 太阳(逆3) → 武曲(逆4) → 
+     *       天同(逆5) → 空 → 空 → 廉贞(逆8)
+     */
+    array<int, 14> get_zhu_xing_positions(int zi_wei_index) {
+        using enum ZhuXing;
+        int tian_fu_index = get_tian_fu_index(zi_wei_index);
+        array<int, 14> positions{};
+
+        // 紫微星系：逆行
+        positions[static_cast<int>(ZiWei)] = zi_wei_index;
+        positions[static_cast<int>(TianJi)] = fix_index(zi_wei_index - 1);
+        positions[static_cast<int>(TaiYang)] = fix_index(zi_wei_index - 3);
+        positions[static_cast<int>(WuQu)] = fix_index(zi_wei_index - 4);
+        positions[static_cast<int>(TianTong)] = fix_index(zi_wei_index - 5);
+        positions[static_cast<int>(LianZhen)] = fix_index(zi_wei_index - 8);
+
+        // 天府星系：顺行
+        positions[static_cast<int>(TianFu)] = tian_fu_index;
+        positions[static_cast<int>(TaiYin)] = fix_index(tian_fu_index + 1);
+        positions[static_cast<int>(TanLang)] = fix_index(tian_fu_index + 2);
+        positions[static_cast<int>(JuMen)] = fix_index(tian_fu_index + 3);
+        positions[static_cast<int>(TianXiang)] = fix_index(tian_fu_index + 4);
+        positions[static_cast<int>(TianLiang)] = fix_index(tian_fu_index + 5);
+        positions[static_cast<int>(QiSha)] = fix_index(tian_fu_index + 6);
+        positions[static_cast<int>(PoJun)] = fix_index(tian_fu_index + 10);
+
+        return positions;
+    }
+
     /**
      * @brief 安紫微诸星诀
      * 
@@ -77,15 +113,11 @@ namespace ZhouYi::ZiWei {
      *       天同(逆5) → 空 → 空 → 廉贞(逆8)
      */
     map<ZhuXing, int> arrange_zi_wei_group(int zi_wei_index) {
+        auto all = get_zhu_xing_positions(zi_wei_index);
         map<ZhuXing, int> positions;
-        
-        positions[ZhuXing::ZiWei] = zi_wei_index;
-        positions[ZhuXing::TianJi] = fix_index(zi_wei_index - 1);
-        positions[ZhuXing::TaiYang] = fix_index(zi_wei_index - 3);
-        positions[ZhuXing::WuQu] = fix_index(zi_wei_index - 4);
-        positions[ZhuXing::TianTong] = fix_index(zi_wei_index - 5);
-        positions[ZhuXing::LianZhen] = fix_index(zi_wei_index - 8);
-        
+        for (int s = static_cast<int>(ZhuXing::ZiWei); s <= static_cast<int>(ZhuXing::LianZhen); ++s) {
+            positions[static_cast<ZhuXing>(s)] = all[s];
+        }
         return positions;
     }
 
@@ -100,17 +132,12 @@ namespace ZhouYi::ZiWei {
      *       天梁(顺5) → 七杀(顺6) → 空 → 空 → 空 → 破军(顺10)
      */
     map<ZhuXing, int> arrange_tian_fu_group(int tian_fu_index) {
+        // 天府与紫微相对，反推紫微后统一安星
+        auto all = get_zhu_xing_positions(fix_index(tian_fu_index - 6));
         map<ZhuXing, int> positions;
-        
-        positions[ZhuXing::TianFu] = tian_fu_index;
-        positions[ZhuXing::TaiYin] = fix_index(tian_fu_index + 1);
-        positions[ZhuXing::TanLang] = fix_index(tian_fu_index + 2);
-        positions[ZhuXing::JuMen] = fix_index(tian_fu_index + 3);
-        positions[ZhuXing::TianXiang] = fix_index(tian_fu_index + 4);
-        positions[ZhuXing::TianLiang] = fix_index(tian_fu_index + 5);
-        positions[ZhuXing::QiSha] = fix_index(tian_fu_index + 6);
-        positions[ZhuXing::PoJun] = fix_index(tian_fu_index + 10);
-        
+        for (int s = static_cast<int>(ZhuXing::TianFu); s <= static_cast<int>(ZhuXing::PoJun); ++s) {
+            positions[static_cast<ZhuXing>(s)] = all[s];
+        }
         return positions;
     }
 
@@ -203,41 +230,6 @@ namespace ZhouYi::ZiWei {
         return {chang_index, qu_index};
     }
 
-    /**
-     * @brief 安天魁天钺诀
-     * 
-     * 口诀：
-     * 甲戊庚之年丑未，乙己之年子申，
-     * 丙丁之年亥酉，辛年午寅，
-     * 壬癸之年卯巳。
-     * 
-     * 说明：天魁天钺按年干起，前者为魁后者为钺
-     */
-    pair<int, int> get_kui_yue_index(TianGan year_gan) {
-        // 地支索引映射（以寅宫为0）：
-        // 寅0 卯1 辰2 巳3 午4 未5 申6 酉7 戌8 亥9 子10 丑11
-        
-        switch (year_gan) {
-            case TianGan::Jia:
-            case TianGan::Wu:
-            case TianGan::Geng:
-                return {11, 5}; // 丑未
-            case TianGan::Yi:
-            case TianGan::Ji:
-                return {10, 6}; // 子申
-            case TianGan::Bing:
-            case TianGan::Ding:
-                return {9, 7};  // 亥酉
-            case TianGan::Xin:
-                return {4, 0};  // 午寅
-            case TianGan::Ren:
-            case TianGan::Gui:
-                return {1, 3};  // 卯巳
-            default:
-                return {0, 0};
-        }
-    }
-
     /**
      * @brief 定禄存诀
      * 
@@ -263,133 +255,39 @@ namespace ZhouYi::ZiWei {
         }
     }
 
-    /**
-     * @brief 定擎羊陀罗诀
-     * 
-     * 口诀：
-     * 禄前羊刃当，禄后陀罗府。
-     * 
-     * 解释：擎羊在禄存前一位，陀罗在禄存后一位
-     */
-    pair<int, int> get_yang_tuo_index(int lu_cun_index) {
-        return {
-            fix_index(lu_cun_index + 1),  // 擎羊在禄存前一位
-            fix_index(lu_cun_index - 1)   // 陀罗在禄存后一位
-        };
-    }
+    array<int, 4> get_si_hua_xing(TianGan year_gan) {
+        using enum ZhuXing;
+        constexpr int N = -1;
+        constexpr auto x = [](ZhuXing star) { return static_cast<int>(star); };
+        // 按年干排列，每行依次为化禄、化权、化科、化忌所化主星
+        constexpr array<array<int, 4>, 10> table = {{
+            {x(LianZhen), x(PoJun), x(WuQu), x(TaiYang)},              // 甲
+            {x(TianJi), x(TianLiang), x(ZiWei), x(TaiYin)},            // 乙
+            {x(TianTong), x(TianJi), N, x(LianZhen)},                  // 丙
+            {x(TaiYin), x(TianTong), x(TianJi), x(JuMen)},             // 丁
+            {x(TanLang), x(TaiYin), N, x(TianJi)},                     // 戊
+            {x(WuQu), x(TanLang), x(TianLiang), N},                    // 己
+            {x(TaiYang), x(WuQu), x(TaiYin), x(TianTong)},             // 庚
+            {x(JuMen), x(TaiYang), N, N},                              // 辛
+            {x(TianLiang), x(ZiWei), N, x(WuQu)},                      // 壬
+            {x(PoJun), x(JuMen), x(TaiYin), x(TanLang)}                // 癸
+        }};
 
-    /**
-     * @brief 安火星铃星诀
-     * 
-     * 口诀：
-     * 申子辰人寅戌扬，寅午戌人丑卯方，
-     * 巳酉丑人卯戌位，亥卯未人酉戌房。
-     * 
-     * 解释：前者为火星起始位，后者为铃星起始位，再从时辰顺数
-     */
-    pair<int, int> get_huo_ling_index(DiZhi year_zhi, DiZhi hour_zhi) {
-        int hour_offset = static_cast<int>(hour_zhi);
-        int huo_start, ling_start;
-        
-        if (year_zhi == DiZhi::Shen || year_zhi == DiZhi::Zi || year_zhi == DiZhi::Chen) {
-            huo_start = 0;  // 寅
-            ling_start = 8; // 戌
-        } else if (year_zhi == DiZhi::Yin || year_zhi == DiZhi::Wu || year_zhi == DiZhi::Xu) {
-            huo_start = 11; // 丑
-            ling_start = 1;  // 卯
-        } else if (year_zhi == DiZhi::Si || year_zhi == DiZhi::You || year_zhi == DiZhi::Chou) {
-            huo_start = 1;  // 卯
-            ling_start = 8; // 戌
-        } else { // 亥卯未
-            huo_start = 7;  // 酉
-            ling_start = 8; // 戌
+        int gan = static_cast<int>(year_gan);
+        if (gan < 0 || gan >= 10) {
+            return {N, N, N, N};
         }
-        
-        return {
-            fix_index(huo_start + hour_offset),
-            fix_index(ling_start + hour_offset)
-        };
-    }
-
-    /**
-     * @brief 安地空地劫诀
-     * 
-     * 口诀：
-     * 亥上子时顺安劫，
-     * 逆回便是地空亡。
-     * 
-     * 解释：从亥宫起子时，顺数为地劫，逆数为地空
-     */
-    pair<int, int> get_kong_jie_index(DiZhi hour_zhi) {
-        int hour_index = static_cast<int>(hour_zhi);
-        int hai_index = 9; // 亥宫索引
-        
-        return {
-            fix_index(hai_index - hour_index), // 地空（逆数）
-            fix_index(hai_index + hour_index)  // 地劫（顺数）
-        };
+        return table[gan];
     }
 
     map<ZhuXing, SiHua> get_si_hua_table(TianGan year_gan) {
         map<ZhuXing, SiHua> table;
-        
-        switch (year_gan) {
-            case TianGan::Jia:
-                table[ZhuXing::LianZhen] = SiHua::Lu;
-                table[ZhuXing::PoJun] = SiHua::Quan;
-                table[ZhuXing::WuQu] = SiHua::Ke;
-                table[ZhuXing::TaiYang] = SiHua::Ji;
-                break;
-            case TianGan::Yi:
-                table[ZhuXing::TianJi] = SiHua::Lu;
-                table[ZhuXing::TianLiang] = SiHua::Quan;
-                table[ZhuXing::ZiWei] = SiHua::Ke;
-                table[ZhuXing::TaiYin] = SiHua::Ji;
-                break;
-            case TianGan::Bing:
-                table[ZhuXing::TianTong] = SiHua::Lu;
-                table[ZhuXing::TianJi] = SiHua::Quan;
-                table[ZhuXing::LianZhen] = SiHua::Ji;
-                break;
-            case TianGan::Ding:
-                table[ZhuXing::TaiYin] = SiHua::Lu;
-                table[ZhuXing::TianTong] = SiHua::Quan;
-                table[ZhuXing::TianJi] = SiHua::Ke;
-                table[ZhuXing::JuMen] = SiHua::Ji;
-                break;
-            case TianGan::Wu:
-                table[ZhuXing::TanLang] = SiHua::Lu;
-                table[ZhuXing::TaiYin] = SiHua::Quan;
-                table[ZhuXing::TianJi] = SiHua::Ji;
-                break;
-            case TianGan::Ji:
-                table[ZhuXing::WuQu] = SiHua::Lu;
-                table[ZhuXing::TanLang] = SiHua::Quan;
-                table[ZhuXing::TianLiang] = SiHua::Ke;
-                break;
-            case TianGan::Geng:
-                table[ZhuXing::TaiYang] = SiHua::Lu;
-                table[ZhuXing::WuQu] = SiHua::Quan;
-                table[ZhuXing::TaiYin] = SiHua::Ke;
-                table[ZhuXing::TianTong] = SiHua::Ji;
-                break;
-            case TianGan::Xin:
-                table[ZhuXing::JuMen] = SiHua::Lu;
-                table[ZhuXing::TaiYang] = SiHua::Quan;
-                break;
-            case TianGan::Ren:
-                table[ZhuXing::TianLiang] = SiHua::Lu;
-                table[ZhuXing::ZiWei] = SiHua::Quan;
-                table[ZhuXing::WuQu] = SiHua::Ji;
-                break;
-            case TianGan::Gui:
-                table[ZhuXing::PoJun] = SiHua::Lu;
-                table[ZhuXing::JuMen] = SiHua::Quan;
-                table[ZhuXing::TaiYin] = SiHua::Ke;
-                table[ZhuXing::TanLang] = SiHua::Ji;
-                break;
+        auto xing = get_si_hua_xing(year_gan);
+        for (int h = 0; h < 4; ++h) {
+            if (xing[h] >= 0) {
+                table[static_cast<ZhuXing>(xing[h])] = static_cast<SiHua>(h);
+            }
         }
-        
         return table;
     }
 
@@ -402,621 +300,1355 @@ namespace ZhouYi::ZiWei {
         return mapping[static_cast<int>(zhi)];
     }
 
-    /**
-     * @brief 安红鸾天喜诀
-     * 
-     * 口诀：
-     * 卯上起子逆数之，数到当生太岁支，
-     * 坐守此宫红鸾位，对宫天喜不差移。
-     * 
-     * 解释：从卯宫起子年逆数至出生年支为红鸾，对宫为天喜
-     */
-    pair<int, int> get_hong_luan_tian_xi_index(DiZhi year_zhi) {
-        // 卯上起子逆数之，数到当生太岁支
-        int zhi_idx = static_cast<int>(year_zhi);
-        int hong_luan_index = fix_index(1 - zhi_idx); // 卯宫为1
-        int tian_xi_index = fix_index(hong_luan_index + 6); // 对宫
-        return {hong_luan_index, tian_xi_index};
-    }
+    // ============= 安星口诀（编译期求值，用于生成查找表） =============
 
-    /**
-     * @brief 安三台八座诀
-     * 
-     * 口诀：
-     * 由左辅之宫位起初一，顺行至生日安三台。
-     * 由右弼之宫位起初一，逆行至生日安八座。
-     */
-    pair<int, int> get_san_tai_ba_zuo_index(int lunar_month, int lunar_day, DiZhi hour_zhi) {
-        auto [zuo_idx, you_idx] = get_zuo_you_index(lunar_month);
+    namespace rule {
+        /**
+         * @brief 安天魁天钺诀
+         * 
+         * 口诀：
+         * 甲戊庚之年丑未，乙己之年子申，
+         * 丙丁之年亥酉，辛年午寅，
+         * 壬癸之年卯巳。
+         * 
+         * 说明：天魁天钺按年干起，前者为魁后者为钺
+         */
+        constexpr pair<int, int> kui_yue(TianGan year_gan) {
+            // 地支索引映射（以寅宫为0）：
+            // 寅0 卯1 辰2 巳3 午4 未5 申6 酉7 戌8 亥9 子10 丑11
         
-        // 晚子时需要加一天
-        int day_offset = (hour_zhi == DiZhi::Zi && static_cast<int>(hour_zhi) >= 12) ? 1 : 0;
-        int day_index = (lunar_day + day_offset - 1) % 12;
+            switch (year_gan) {
+                case TianGan::Jia:
+                case TianGan::Wu:
+                case TianGan::Geng:
+                    return {11, 5}; // 丑未
+                case TianGan::Yi:
+                case TianGan::Ji:
+                    return {10, 6}; // 子申
+                case TianGan::Bing:
+                case TianGan::Ding:
+                    return {9, 7};  // 亥酉
+                case TianGan::Xin:
+                    return {4, 0};  // 午寅
+                case TianGan::Ren:
+                case TianGan::Gui:
+                    return {1, 3};  // 卯巳
+                default:
+                    return {0, 0};
+            }
+        }
+
+        /**
+         * @brief 定擎羊陀罗诀
+         * 
+         * 口诀：
+         * 禄前羊刃当，禄后陀罗府。
+         * 
+         * 解释：擎羊在禄存前一位，陀罗在禄存后一位
+         */
+        constexpr pair<int, int> yang_tuo(int lu_cun_index) {
+            return {
+                fix_index(lu_cun_index + 1),  // 擎羊在禄存前一位
+                fix_index(lu_cun_index - 1)   // 陀罗在禄存后一位
+            };
+        }
+
+        /**
+         * @brief 安火星铃星诀
+         * 
+         * 口诀：
+         * 申子辰人寅戌扬，寅午戌人丑卯方，
+         * 巳酉丑人卯戌位，亥卯未人酉戌房。
+         * 
+         * 解释：前者为火星起始位，后者为铃星起始位，再从时辰顺数
+         */
+        constexpr pair<int, int> huo_ling(DiZhi year_zhi, DiZhi hour_zhi) {
+            int hour_offset = static_cast<int>(hour_zhi);
+            int huo_start, ling_start;
         
-        int san_tai_index = fix_index(zuo_idx + day_index);
-        int ba_zuo_index = fix_index(you_idx - day_index);
+            if (year_zhi == DiZhi::Shen || year_zhi == DiZhi::Zi || year_zhi == DiZhi::Chen) {
+                huo_start = 0;  // 寅
+                ling_start = 8; // 戌
+            } else if (year_zhi == DiZhi::Yin || year_zhi == DiZhi::Wu || year_zhi == DiZhi::Xu) {
+                huo_start = 11; // 丑
+                ling_start = 1;  // 卯
+            } else if (year_zhi == DiZhi::Si || year_zhi == DiZhi::You || year_zhi == DiZhi::Chou) {
+                huo_start = 1;  // 卯
+                ling_start = 8; // 戌
+            } else { // 亥卯未
+                huo_start = 7;  // 酉
+                ling_start = 8; // 戌
+            }
         
-        return {san_tai_index, ba_zuo_index};
-    }
+            return {
+                fix_index(huo_start + hour_offset),
+                fix_index(ling_start + hour_offset)
+            };
+        }
 
-    /**
-     * @brief 安恩光天贵诀
-     * 
-     * 口诀：
-     * 由文昌之宫位起初一，顺行至生日再退一步起恩光。
-     * 由文曲之宫位起初一，顺行至生日再退一步起天贵。
-     */
-    pair<int, int> get_en_guang_tian_gui_index(int lunar_month, int lunar_day, DiZhi hour_zhi) {
-        auto [chang_idx, qu_idx] = get_chang_qu_index(hour_zhi);
+        /**
+         * @brief 安地空地劫诀
+         * 
+         * 口诀：
+         * 亥上子时顺安劫，
+         * 逆回便是地空亡。
+         * 
+         * 解释：从亥宫起子时，顺数为地劫，逆数为地空
+         */
+        constexpr pair<int, int> kong_jie(DiZhi hour_zhi) {
+            int hour_index = static_cast<int>(hour_zhi);
+            int hai_index = 9; // 亥宫索引
+        
+            return {
+                fix_index(hai_index - hour_index), // 地空（逆数）
+                fix_index(hai_index + hour_index)  // 地劫（顺数）
+            };
+        }
+
+        /**
+         * @brief 安天马诀
+         * 
+         * 口诀：
+         * 寅午戌年马在申，申子辰年马在寅，
+         * 巳酉丑年马在亥，亥卯未年马在巳。
+         */
+        constexpr int tian_ma(DiZhi year_zhi) {
+            if (year_zhi == DiZhi::Yin || year_zhi == DiZhi::Wu || year_zhi == DiZhi::Xu) {
+                return 6; // 申
+            } else if (year_zhi == DiZhi::Shen || year_zhi == DiZhi::Zi || year_zhi == DiZhi::Chen) {
+                return 0; // 寅
+            } else if (year_zhi == DiZhi::Si || year_zhi == DiZhi::You || year_zhi == DiZhi::Chou) {
+                return 9; // 亥
+            } else { // 亥卯未
+                return 3; // 巳
+            }
+        }
+
+        /**
+         * @brief 安红鸾天喜诀
+         * 
+         * 口诀：
+         * 卯上起子逆数之，数到当生太岁支，
+         * 坐守此宫红鸾位，对宫天喜不差移。
+         * 
+         * 解释：从卯宫起子年逆数至出生年支为红鸾，对宫为天喜
+         */
+        constexpr pair<int, int> hong_luan_tian_xi(DiZhi year_zhi) {
+            // 卯上起子逆数之，数到当生太岁支
+            int zhi_idx = static_cast<int>(year_zhi);
+            int hong_luan_index = fix_index(1 - zhi_idx); // 卯宫为1
+            int tian_xi_index = fix_index(hong_luan_index + 6); // 对宫
+            return {hong_luan_index, tian_xi_index};
+        }
+
+        /**
+         * @brief 安三台八座诀
+         * 
+         * 口诀：
+         * 由左辅之宫位起初一，顺行至生日安三台。
+         * 由右弼之宫位起初一，逆行至生日安八座。
+         */
+        constexpr pair<int, int> san_tai_ba_zuo(int lunar_month, int lunar_day, DiZhi hour_zhi) {
+            auto [zuo_idx, you_idx] = get_zuo_you_index(lunar_month);
+        
+            // 晚子时需要加一天
+            int day_offset = (hour_zhi == DiZhi::Zi && static_cast<int>(hour_zhi) >= 12) ? 1 : 0;
+            int day_index = (lunar_day + day_offset - 1) % 12;
+        
+            int san_tai_index = fix_index(zuo_idx + day_index);
+            int ba_zuo_index = fix_index(you_idx - day_index);
+        
+            return {san_tai_index, ba_zuo_index};
+        }
+
+        /**
+         * @brief 安恩光天贵诀
+         * 
+         * 口诀：
+         * 由文昌之宫位起初一，顺行至生日再退一步起恩光。
+         * 由文曲之宫位起初一，顺行至生日再退一步起天贵。
+         */
+        constexpr pair<int, int> en_guang_tian_gui(int lunar_month, int lunar_day, DiZhi hour_zhi) {
+            auto [chang_idx, qu_idx] = get_chang_qu_index(hour_zhi);
+        
+            int day_offset = (hour_zhi == DiZhi::Zi && static_cast<int>(hour_zhi) >= 12) ? 1 : 0;
+            int day_index = (lunar_day + day_offset - 1) % 12;
         
-        int day_offset = (hour_zhi == DiZhi::Zi && static_cast<int>(hour_zhi) >= 12) ? 1 : 0;
-        int day_index = (lunar_day + day_offset - 1) % 12;
+            int en_guang_index = fix_index((chang_idx + day_index) - 1);
+            int tian_gui_index = fix_index((qu_idx + day_index) - 1);
         
-        int en_guang_index = fix_index((chang_idx + day_index) - 1);
-        int tian_gui_index = fix_index((qu_idx + day_index) - 1);
+            return {en_guang_index, tian_gui_index};
+        }
+
+        /**
+         * @brief 安龙池凤阁诀
+         * 
+         * 口诀：
+         * 龙池从辰宫起子，顺至本生年支安之。
+         * 凤阁从戌宫起子，逆行至本生年支安之。
+         */
+        constexpr pair<int, int> long_chi_feng_ge(DiZhi year_zhi) {
+            int zhi_idx = static_cast<int>(year_zhi);
+            int long_chi_index = fix_index(2 + zhi_idx); // 辰宫为2
+            int feng_ge_index = fix_index(8 - zhi_idx);  // 戌宫为8
+            return {long_chi_index, feng_ge_index};
+        }
+
+        /**
+         * @brief 安天才天寿诀
+         * 
+         * 口诀：
+         * 天才由命宫起子，顺行至本生年支安之。
+         * 天寿由身宫起子，顺行至本生年支安之。
+         */
+        constexpr pair<int, int> tian_cai_tian_shou(DiZhi year_zhi, int ming_index, int shen_index) {
+            int zhi_idx = static_cast<int>(year_zhi);
+            int tian_cai_index = fix_index(ming_index + zhi_idx);
+            int tian_shou_index = fix_index(shen_index + zhi_idx);
+            return {tian_cai_index, tian_shou_index};
+        }
+
+        /**
+         * @brief 安台辅封诰诀
+         * 
+         * 台辅：午宫起子时，顺数至生时安之
+         * 封诰：寅宫起子时，顺数至生时安之
+         */
+        constexpr pair<int, int> tai_fu_feng_gao(DiZhi hour_zhi) {
+            int hour_idx = static_cast<int>(hour_zhi);
+            int tai_fu_index = fix_index(4 + hour_idx);  // 午宫为4
+            int feng_gao_index = fix_index(0 + hour_idx); // 寅宫为0
+            return {tai_fu_index, feng_gao_index};
+        }
+
+        /**
+         * @brief 安天官天福诀
+         * 
+         * 口诀：
+         * 甲喜羊鸡乙龙猴，丙年蛇鼠一窝谋。
+         * 丁虎擒猪戊玉兔，己鸡居然与虎俦。
+         * 庚猪马辛鸡蛇走，壬犬马癸马蛇游。
+         * 
+         * 说明：前者为天官，后者为天福
+         */
+        constexpr pair<int, int> tian_guan_tian_fu(TianGan year_gan) {
+            // 天官天福口诀
+            constexpr array<pair<int, int>, 10> mapping = {
+                pair{5, 7},   // 甲：未酉
+                pair{2, 6},   // 乙：辰申
+                pair{3, 10},  // 丙：巳子
+                pair{0, 9},   // 丁：寅亥
+                pair{1, 1},   // 戊：卯卯
+                pair{7, 0},   // 己：酉寅
+                pair{9, 4},   // 庚：亥午
+                pair{7, 3},   // 辛：酉巳
+                pair{8, 4},   // 壬：戌午
+                pair{4, 3}    // 癸：午巳
+            };
+            return mapping[static_cast<int>(year_gan)];
+        }
+
+        /**
+         * @brief 安天厨诀
+         * 
+         * 口诀：
+         * 甲丁食蛇口，乙戊辛马方。
+         * 丙从鼠口得，己食于猴房。
+         * 庚食虎头上，壬鸡癸猪堂。
+         */
+        constexpr int tian_chu(TianGan year_gan) {
+            // 天厨口诀：甲丁食蛇口，乙戊辛马方...
+            constexpr array<int, 10> mapping = {3, 4, 10, 3, 4, 6, 0, 4, 7, 9};
+            return mapping[static_cast<int>(year_gan)];
+        }
+
+        /**
+         * @brief 安华盖诀
+         * 
+         * 口诀：
+         * 寅午戌年在戌，申子辰年在辰，
+         * 巳酉丑年在丑，亥卯未年在未。
+         */
+        constexpr int hua_gai(DiZhi year_zhi) {
+            // 华盖口诀
+            if (year_zhi == DiZhi::Yin || year_zhi == DiZhi::Wu || year_zhi == DiZhi::Xu) {
+                return 8; // 戌
+            } else if (year_zhi == DiZhi::Shen || year_zhi == DiZhi::Zi || year_zhi == DiZhi::Chen) {
+                return 2; // 辰
+            } else if (year_zhi == DiZhi::Si || year_zhi == DiZhi::You || year_zhi == DiZhi::Chou) {
+                return 11; // 丑
+            } else { // 亥卯未
+                return 5; // 未
+            }
+        }
+
+        /**
+         * @brief 安咸池诀
+         * 
+         * 口诀：
+         * 寅午戌年在卯，申子辰年在酉，
+         * 巳酉丑年在午，亥卯未年在子。
+         */
+        constexpr int xian_chi(DiZhi year_zhi) {
+            // 咸池口诀
+            if (year_zhi == DiZhi::Yin || year_zhi == DiZhi::Wu || year_zhi == DiZhi::Xu) {
+                return 1; // 卯
+            } else if (year_zhi == DiZhi::Shen || year_zhi == DiZhi::Zi || year_zhi == DiZhi::Chen) {
+                return 7; // 酉
+            } else if (year_zhi == DiZhi::Si || year_zhi == DiZhi::You || year_zhi == DiZhi::Chou) {
+                return 4; // 午
+            } else { // 亥卯未
+                return 10; // 子
+            }
+        }
+
+        /**
+         * @brief 安孤辰寡宿诀
+         * 
+         * 口诀：
+         * 寅卯辰年安巳丑，巳午未年安申辰，
+         * 申酉戌年安亥未，亥子丑年安寅戌。
+         * 
+         * 说明：前者为孤辰，后者为寡宿
+         */
+        constexpr pair<int, int> gu_chen_gua_su(DiZhi year_zhi) {
+            // 孤辰寡宿口诀
+            int gu_chen, gua_su;
+            if (year_zhi == DiZhi::Yin || year_zhi == DiZhi::Mao || year_zhi == DiZhi::Chen) {
+                gu_chen = 3;  // 巳
+                gua_su = 11;  // 丑
+            } else if (year_zhi == DiZhi::Si || year_zhi == DiZhi::Wu || year_zhi == DiZhi::Wei) {
+                gu_chen = 6;  // 申
+                gua_su = 2;   // 辰
+            } else if (year_zhi == DiZhi::Shen || year_zhi == DiZhi::You || year_zhi == DiZhi::Xu) {
+                gu_chen = 9;  // 亥
+                gua_su = 5;   // 未
+            } else { // 亥子丑
+                gu_chen = 0;  // 寅
+                gua_su = 8;   // 戌
+            }
+            return {gu_chen, gua_su};
+        }
+
+        /**
+         * @brief 安蜚廉诀
+         * 
+         * 口诀：
+         * 子丑寅年在申酉戌，卯辰巳年在巳午未，
+         * 午未申年在寅卯辰，酉戌亥年在亥子丑。
+         */
+        constexpr int fei_lian(DiZhi year_zhi) {
+            // 蜚廉按年支
+            constexpr array<int, 12> mapping = {6, 7, 8, 3, 4, 5, 0, 1, 2, 9, 10, 11};
+            return mapping[static_cast<int>(year_zhi)];
+        }
+
+        /**
+         * @brief 安破碎诀
+         * 
+         * 口诀：
+         * 子午卯酉年安巳宫，寅申巳亥年安酉宫，
+         * 辰戌丑未年安丑宫。
+         */
+        constexpr int po_sui(DiZhi year_zhi) {
+            // 破碎：子午卯酉年在巳，寅申巳亥年在酉，辰戌丑未年在丑
+            int zhi_idx = static_cast<int>(year_zhi);
+            constexpr array<int, 12> mapping = {3, 11, 7, 7, 11, 11, 3, 11, 7, 7, 3, 11};
+            return mapping[zhi_idx];
+        }
+
+        /**
+         * @brief 安天刑诀
+         * 
+         * 口诀：
+         * 天刑从酉起正月，顺至生月便安之。
+         */
+        constexpr int tian_xing(int lunar_month) {
+            // 天刑从酉起正月，顺至生月
+            return fix_index(7 + (lunar_month - 1)); // 酉宫为7
+        }
+
+        /**
+         * @brief 安天姚诀
+         * 
+         * 口诀：
+         * 天姚丑宫起正月，顺到生月即停留。
+         */
+        constexpr int tian_yao(int lunar_month) {
+            // 天姚从丑起正月，顺至生月
+            return fix_index(11 + (lunar_month - 1)); // 丑宫为11
+        }
+
+        /**
+         * @brief 安解神诀（月解）
+         * 
+         * 口诀：
+         * 正二在申三四在戌，五六在子七八在寅，
+         * 九十月坐于辰宫，十一十二在午宫。
+         */
+        constexpr int jie_shen(int lunar_month) {
+            // 解神（月解）
+            constexpr array<int, 6> positions = {6, 6, 8, 8, 10, 10}; // 申申戌戌子子
+            return positions[(lunar_month - 1) / 2];
+        }
+
+        /**
+         * @brief 安天巫诀
+         * 
+         * 口诀：
+         * 正五九月在巳，二六十月在申，
+         * 三七十一在寅，四八十二在亥。
+         */
+        constexpr int tian_wu(int lunar_month) {
+            // 天巫：正五九在巳，二六十在申，三七十一在寅，四八十二在亥
+            constexpr array<int, 4> positions = {3, 6, 0, 9}; // 巳申寅亥
+            return positions[(lunar_month - 1) % 4];
+        }
+
+        /**
+         * @brief 安天月诀
+         * 
+         * 口诀：
+         * 一犬二蛇三在龙，四虎五羊六兔宫。
+         * 七猪八羊九在虎，十马冬犬腊寅中。
+         */
+        constexpr int tian_yue(int lunar_month) {
+            // 天月：一犬二蛇三在龙...
+            constexpr array<int, 12> mapping = {8, 3, 2, 0, 5, 1, 9, 5, 0, 4, 8, 0};
+            return mapping[lunar_month - 1];
+        }
+
+        /**
+         * @brief 安阴煞诀
+         * 
+         * 口诀：
+         * 正七月在寅，二八月在子，三九月在戌，
+         * 四十月在申，五十一在午，六十二在辰。
+         */
+        constexpr int yin_sha(int lunar_month) {
+            // 阴煞：正七在寅，二八在子，三九在戌...
+            constexpr array<int, 6> positions = {0, 10, 8, 6, 4, 2};
+            return positions[(lunar_month - 1) % 6];
+        }
+
+        /**
+         * @brief 安天德月德诀
+         * 
+         * 天德：从酉宫起子年，顺数至生年
+         * 月德：从巳宫起子年，顺数至生年
+         */
+        constexpr pair<int, int> tian_de_yue_de(DiZhi year_zhi) {
+            int zhi_idx = static_cast<int>(year_zhi);
+            int tian_de_index = fix_index(7 + zhi_idx);  // 酉宫起
+            int yue_de_index = fix_index(3 + zhi_idx);   // 巳宫起
+            return {tian_de_index, yue_de_index};
+        }
+
+        /**
+         * @brief 安天空诀
+         * 
+         * 口诀：
+         * 生年支顺数的前一位就是。
+         */
+        constexpr int tian_kong(DiZhi year_zhi) {
+            // 天空：生年支顺数前一位
+            return fix_index(static_cast<int>(year_zhi) + 1);
+        }
+
+        /**
+         * @brief 安旬空诀
+         * 
+         * 算法：
+         * 从生年地支顺数，加上（9-年干序号）再加1
+         * 若阴阳属性不同，再加1
+         */
+        constexpr int xun_kong(TianGan year_gan, DiZhi year_zhi) {
+            // 旬空计算
+            int gan_idx = static_cast<int>(year_gan);
+            int zhi_idx = static_cast<int>(year_zhi);
+            int xun_kong_idx = fix_index(zhi_idx + (9 - gan_idx) + 1);
+        
+            // 阴阳属性检查
+            if ((zhi_idx % 2) != (xun_kong_idx % 2)) {
+                xun_kong_idx = fix_index(xun_kong_idx + 1);
+            }
+        
+            return xun_kong_idx;
+        }
+
+        /**
+         * @brief 安截路空亡诀
+         * 
+         * 口诀：
+         * 甲己之年申酉，乙庚之年午未，
+         * 丙辛之年辰巳，丁壬之年寅卯，
+         * 戊癸之年子丑。
+         * 
+         * 说明：前者为截路，后者为空亡
+         */
+        constexpr pair<int, int> jie_lu_kong_wang(TianGan year_gan) {
+            // 截路空亡
+            constexpr array<pair<int, int>, 5> mapping = {
+                pair{6, 7},   // 甲己：申酉
+                pair{4, 5},   // 乙庚：午未
+                pair{2, 3},   // 丙辛：辰巳
+                pair{0, 1},   // 丁壬：寅卯
+                pair{10, 11}  // 戊癸：子丑
+            };
+            return mapping[static_cast<int>(year_gan) % 5];
+        }
+
+        /**
+         * @brief 安天哭天虚诀
+         * 
+         * 口诀：
+         * 天哭天虚起午宫，午宫起子两分踪，
+         * 哭逆行兮虚顺转，数到生年便停留。
+         * 
+         * 说明：天哭从午宫起子年逆数，天虚从午宫起子年顺数
+         */
+        constexpr pair<int, int> tian_ku_tian_xu(DiZhi year_zhi) {
+            int zhi_idx = static_cast<int>(year_zhi);
+            int tian_ku_index = fix_index(4 - zhi_idx);  // 午宫起逆数
+            int tian_xu_index = fix_index(4 + zhi_idx);  // 午宫起顺数
+            return {tian_ku_index, tian_xu_index};
+        }
+
+        /**
+         * @brief 安天使天伤诀
+         * 
+         * 口诀：
+         * 天伤奴仆、天使疾厄、夹迁移宫最易寻得。
+         * 凡阳男阴女，皆依此诀，但若为阴男阳女，
+         * 则改为天伤居疾厄、天使居奴仆。
+         * 
+         * 说明：夹迁移宫，阳男阴女天伤在迁移后一位、天使在迁移前一位
+         */
+        constexpr pair<int, int> tian_shi_tian_shang(int ming_index, bool is_male, DiZhi year_zhi) {
+            // 天使天伤：夹迁移宫
+            int qian_yi_index = fix_index(ming_index + 6); // 迁移宫在命宫对宫
+        
+            // 阳男阴女：天伤在奴仆(迁移后一位)，天使在疾厄(迁移前一位)
+            // 阴男阳女：相反
+            int zhi_idx = static_cast<int>(year_zhi);
+            bool yang_zhi = (zhi_idx % 2 == 0);
+            bool same_yin_yang = (is_male == yang_zhi);
+        
+            int tian_shi_index, tian_shang_index;
+            if (same_yin_yang) {
+                tian_shang_index = fix_index(qian_yi_index + 1);
+                tian_shi_index = fix_index(qian_yi_index - 1);
+            } else {
+                tian_shi_index = fix_index(qian_yi_index + 1);
+                tian_shang_index = fix_index(qian_yi_index - 1);
+            }
+        
+            return {tian_shi_index, tian_shang_index};
+        }
+
+        /**
+         * @brief 安年解诀
+         * 
+         * 口诀：
+         * 解神从戌上起子，逆数至当生年太岁上是也。
+         */
+        constexpr int nian_jie(DiZhi year_zhi) {
+            // 年解：从戌起子，逆数至当生年太岁
+            constexpr array<int, 12> mapping = {8, 7, 6, 5, 4, 3, 2, 1, 0, 11, 10, 9};
+            return mapping[static_cast<int>(year_zhi)];
+        }
+
+        /**
+         * @brief 获取长生12神起始位置
+         * 
+         * 口诀：
+         * 水二局长生在申，木三局长生在亥，
+         * 金四局长生在巳，土五局长生在申，
+         * 火六局长生在寅。
+         */
+        constexpr int chang_sheng_12_start(WuXingJu wu_xing_ju) {
+            switch (wu_xing_ju) {
+                case WuXingJu::ShuiErJu:
+                    return 6; // 申
+                case WuXingJu::MuSanJu:
+                    return 9; // 亥
+                case WuXingJu::JinSiJu:
+                    return 3; // 巳
+                case WuXingJu::TuWuJu:
+                    return 6; // 申
+                case WuXingJu::HuoLiuJu:
+                    return 0; // 寅
+                default:
+                    return 0;
+            }
+        }
+
+        /**
+         * @brief 安长生12神
+         * 
+         * 口诀：
+         * 阳男阴女顺行，阴男阳女逆行，
+         * 安长生、沐浴、冠带、临官、帝旺、衰、
+         * 病、死、墓、绝、胎、养。
+         */
+        constexpr array<ChangSheng12, 12> chang_sheng_12(
+            WuXingJu wu_xing_ju,
+            bool is_male,
+            DiZhi year_zhi
+        ) {
+            array<ChangSheng12, 12> result{};
         
-        return {en_guang_index, tian_gui_index};
+            constexpr array<ChangSheng12, 12> shun_xu = {
+                ChangSheng12::ChangSheng, ChangSheng12::MuYu, ChangSheng12::GuanDai,
+                ChangSheng12::LinGuan, ChangSheng12::DiWang, ChangSheng12::Shuai,
+                ChangSheng12::Bing, ChangSheng12::Si, ChangSheng12::Mu,
+                ChangSheng12::Jue, ChangSheng12::Tai, ChangSheng12::Yang
+            };
+        
+            int start_idx = chang_sheng_12_start(wu_xing_ju);
+        
+            // 判断阴阳：阳男阴女顺行，阴男阳女逆行
+            int zhi_idx = static_cast<int>(year_zhi);
+            bool yang_zhi = (zhi_idx % 2 == 0);
+            bool shun_xing = (is_male == yang_zhi);
+        
+            for (int i = 0; i < 12; ++i) {
+                int idx = shun_xing 
+                    ? fix_index(start_idx + i) 
+                    : fix_index(start_idx - i);
+                result[idx] = shun_xu[i];
+            }
+        
+            return result;
+        }
+
+        /**
+         * @brief 安博士12神
+         * 
+         * 口诀：
+         * 从禄存起，阳男阴女顺行，阴男阳女逆行。
+         * 安博士、力士、青龙、小耗、将军、奏书、
+         * 飞廉、喜神、病符、大耗、伏兵、官府。
+         */
+        constexpr array<BoShi12, 12> bo_shi_12(
+            TianGan year_gan,
+            DiZhi year_zhi,
+            bool is_male
+        ) {
+            array<BoShi12, 12> result{};
+        
+            constexpr array<BoShi12, 12> shun_xu = {
+                BoShi12::BoShi, BoShi12::LiShi, BoShi12::QingLong,
+                BoShi12::XiaoHao2, BoShi12::JiangJun, BoShi12::ZouShu,
+                BoShi12::FeiLian2, BoShi12::XiShen2, BoShi12::BingFu2,
+                BoShi12::DaHao2, BoShi12::FuBing, BoShi12::GuanFu2
+            };
+        
+            // 从禄存起
+            int lu_cun_idx = get_lu_cun_index(year_gan);
+        
+            // 阳男阴女顺行，阴男阳女逆行
+            int zhi_idx = static_cast<int>(year_zhi);
+            bool yang_zhi = (zhi_idx % 2 == 0);
+            bool shun_xing = (is_male == yang_zhi);
+        
+            for (int i = 0; i < 12; ++i) {
+                int idx = shun_xing 
+                    ? fix_index(lu_cun_idx + i) 
+                    : fix_index(lu_cun_idx - i);
+                result[idx] = shun_xu[i];
+            }
+        
+            return result;
+        }
+
+        /**
+         * @brief 获取将前12神起始位置
+         * 
+         * 口诀：
+         * 寅午戌年将星午，申子辰年子将星，
+         * 巳酉丑将酉上驻，亥卯未将卯上停。
+         */
+        constexpr int jiang_qian_12_start(DiZhi year_zhi) {
+            // 寅午戌年将星午，申子辰年子将星，巳酉丑将酉上驻，亥卯未将卯上停
+            if (year_zhi == DiZhi::Yin || year_zhi == DiZhi::Wu || year_zhi == DiZhi::Xu) {
+                return 4; // 午
+            } else if (year_zhi == DiZhi::Shen || year_zhi == DiZhi::Zi || year_zhi == DiZhi::Chen) {
+                return 10; // 子
+            } else if (year_zhi == DiZhi::Si || year_zhi == DiZhi::You || year_zhi == DiZhi::Chou) {
+                return 7; // 酉
+            } else { // 亥卯未
+                return 1; // 卯
+            }
+        }
+
+        /**
+         * @brief 安流年岁前12神
+         * 
+         * 口诀：
+         * 流年地支起岁建，岁前首先是晦气，
+         * 丧门贯索及官符，小耗大耗龙德继，
+         * 白虎天德连吊客，病符居后须当记。
+         */
+        constexpr array<SuiQian12, 12> sui_qian_12(DiZhi year_zhi) {
+            array<SuiQian12, 12> result{};
+        
+            constexpr array<SuiQian12, 12> shun_xu = {
+                SuiQian12::SuiJian, SuiQian12::HuiQi, SuiQian12::SangMen,
+                SuiQian12::GuanSuo, SuiQian12::GuanFu, SuiQian12::XiaoHao,
+                SuiQian12::DaHao, SuiQian12::LongDe, SuiQian12::BaiHu,
+                SuiQian12::TianDe2, SuiQian12::DiaoKe, SuiQian12::BingFu
+            };
+        
+            int start_idx = di_zhi_to_index(year_zhi);
+        
+            for (int i = 0; i < 12; ++i) {
+                int idx = fix_index(start_idx + i);
+                result[idx] = shun_xu[i];
+            }
+        
+            return result;
+        }
+
+        /**
+         * @brief 安流年将前12神
+         * 
+         * 口诀：
+         * 攀鞍岁驿并息神，华盖劫煞灾煞轻，
+         * 天煞指背咸池续，月煞亡神次第行。
+         */
+        constexpr array<JiangQian12, 12> jiang_qian_12(DiZhi year_zhi) {
+            array<JiangQian12, 12> result{};
+        
+            constexpr array<JiangQian12, 12> shun_xu = {
+                JiangQian12::JiangXing, JiangQian12::PanAn, JiangQian12::SuiYi,
+                JiangQian12::XiShen, JiangQian12::HuaGai2, JiangQian12::JieSha,
+                JiangQian12::ZaiSha, JiangQian12::TianSha, JiangQian12::ZhiBei,
+                JiangQian12::XianChi2, JiangQian12::YueSha, JiangQian12::WangShen
+            };
+        
+            int start_idx = jiang_qian_12_start(year_zhi);
+        
+            for (int i = 0; i < 12; ++i) {
+                int idx = fix_index(start_idx + i);
+                result[idx] = shun_xu[i];
+            }
+        
+            return result;
+        }
+
+    } // namespace rule
+
+    // ============= 编译期查找表 =============
+
+    namespace {
+        constexpr uint8_t u8(int value) {
+            return static_cast<uint8_t>(value);
+        }
+
+        /**
+         * @brief 按年干的星耀宫位
+         */
+        struct GanStars {
+            uint8_t tian_kui, tian_yue, lu_cun, qing_yang, tuo_luo;
+            uint8_t tian_guan, tian_fu, tian_chu, jie_lu, kong_wang;
+        };
+
+        /**
+         * @brief 按年支的星耀宫位
+         */
+        struct ZhiStars {
+            uint8_t tian_ma, hong_luan, tian_xi, long_chi, feng_ge, hua_gai, xian_chi;
+            uint8_t gu_chen, gua_su, fei_lian, po_sui, tian_de, yue_de;
+            uint8_t tian_kong, tian_ku, tian_xu, nian_jie, jiang_qian_start;
+        };
+
+        /**
+         * @brief 按农历月的星耀宫位
+         */
+        struct MonthStars {
+            uint8_t zuo_fu, you_bi, tian_xing, tian_yao, jie_shen, tian_wu, tian_yue, yin_sha;
+        };
+
+        /**
+         * @brief 按时辰的星耀宫位
+         */
+        struct HourStars {
+            uint8_t wen_chang, wen_qu, di_kong, di_jie, tai_fu, feng_gao;
+        };
+
+        template <typename F>
+        constexpr auto make_zhi_table(F f) {
+            array<decltype(f(DiZhi::Zi)), 12> table{};
+            for (int z = 0; z < 12; ++z) {
+                table[z] = f(static_cast<DiZhi>(z));
+            }
+            return table;
+        }
+
+        constexpr auto GAN_TABLE = [] {
+            array<GanStars, 10> table{};
+            for (int g = 0; g < 10; ++g) {
+                auto gan = static_cast<TianGan>(g);
+                auto [kui, yue] = rule::kui_yue(gan);
+                int lu = get_lu_cun_index(gan);
+                auto [yang, tuo] = rule::yang_tuo(lu);
+                auto [guan, fu] = rule::tian_guan_tian_fu(gan);
+                auto [jie_lu, kong_wang] = rule::jie_lu_kong_wang(gan);
+                table[g] = GanStars{u8(kui), u8(yue), u8(lu), u8(yang), u8(tuo),
+                                    u8(guan), u8(fu), u8(rule::tian_chu(gan)), u8(jie_lu), u8(kong_wang)};
+            }
+            return table;
+        }();
+
+        constexpr auto ZHI_TABLE = [] {
+            array<ZhiStars, 12> table{};
+            for (int z = 0; z < 12; ++z) {
+                auto zhi = static_cast<DiZhi>(z);
+                auto [hong_luan, tian_xi] = rule::hong_luan_tian_xi(zhi);
+                auto [long_chi, feng_ge] = rule::long_chi_feng_ge(zhi);
+                auto [gu_chen, gua_su] = rule::gu_chen_gua_su(zhi);
+                auto [tian_de, yue_de] = rule::tian_de_yue_de(zhi);
+                auto [tian_ku, tian_xu] = rule::tian_ku_tian_xu(zhi);
+                table[z] = ZhiStars{
+                    u8(rule::tian_ma(zhi)), u8(hong_luan), u8(tian_xi), u8(long_chi), u8(feng_ge),
+                    u8(rule::hua_gai(zhi)), u8(rule::xian_chi(zhi)),
+                    u8(gu_chen), u8(gua_su), u8(rule::fei_lian(zhi)), u8(rule::po_sui(zhi)), u8(tian_de), u8(yue_de),
+                    u8(rule::tian_kong(zhi)), u8(tian_ku), u8(tian_xu), u8(rule::nian_jie(zhi)),
+                    u8(rule::jiang_qian_12_start(zhi))
+                };
+            }
+            return table;
+        }();
+
+        // 以 fix_index(月 - 1) 为下标；闰月（负数）按同余折入
+        constexpr auto MONTH_TABLE = [] {
+            array<MonthStars, 12> table{};
+            for (int m = 1; m <= 12; ++m) {
+                auto [zuo, you] = get_zuo_you_index(m);
+                table[m - 1] = MonthStars{
+                    u8(zuo), u8(you), u8(rule::tian_xing(m)), u8(rule::tian_yao(m)),
+                    u8(rule::jie_shen(m)), u8(rule::tian_wu(m)), u8(rule::tian_yue(m)), u8(rule::yin_sha(m))
+                };
+            }
+            return table;
+        }();
+
+        constexpr auto HOUR_TABLE = [] {
+            array<HourStars, 12> table{};
+            for (int h = 0; h < 12; ++h) {
+                auto hour = static_cast<DiZhi>(h);
+                auto [chang, qu] = get_chang_qu_index(hour);
+                auto [kong, jie] = rule::kong_jie(hour);
+                auto [tai_fu, feng_gao] = rule::tai_fu_feng_gao(hour);
+                table[h] = HourStars{u8(chang), u8(qu), u8(kong), u8(jie), u8(tai_fu), u8(feng_gao)};
+            }
+            return table;
+        }();
+
+        // 二维表：[年支][时辰]、[月][日 % 12]、[时辰][日 % 12]、[年干][年支]
+        using PairTable = array<array<pair<uint8_t, uint8_t>, 12>, 12>;
+
+        constexpr auto HUO_LING_TABLE = [] {
+            PairTable table{};
+            for (int z = 0; z < 12; ++z) {
+                for (int h = 0; h < 12; ++h) {
+                    auto [huo, ling] = rule::huo_ling(static_cast<DiZhi>(z), static_cast<DiZhi>(h));
+                    table[z][h] = {u8(huo), u8(ling)};
+                }
+            }
+            return table;
+        }();
+
+        constexpr auto SAN_TAI_BA_ZUO_TABLE = [] {
+            PairTable table{};
+            for (int m = 1; m <= 12; ++m) {
+                for (int d = 1; d <= 12; ++d) {
+                    auto [san_tai, ba_zuo] = rule::san_tai_ba_zuo(m, d, DiZhi::Zi);
+                    table[m - 1][d - 1] = {u8(san_tai), u8(ba_zuo)};
+                }
+            }
+            return table;
+        }();
+
+        constexpr auto EN_GUANG_TIAN_GUI_TABLE = [] {
+            PairTable table{};
+            for (int h = 0; h < 12; ++h) {
+                for (int d = 1; d <= 12; ++d) {
+                    auto [en_guang, tian_gui] = rule::en_guang_tian_gui(1, d, static_cast<DiZhi>(h));
+                    table[h][d - 1] = {u8(en_guang), u8(tian_gui)};
+                }
+            }
+            return table;
+        }();
+
+        constexpr auto XUN_KONG_TABLE = [] {
+            array<array<uint8_t, 12>, 10> table{};
+            for (int g = 0; g < 10; ++g) {
+                for (int z = 0; z < 12; ++z) {
+                    table[g][z] = u8(rule::xun_kong(static_cast<TianGan>(g), static_cast<DiZhi>(z)));
+                }
+            }
+            return table;
+        }();
+
+        // 天才天寿：[年支][命宫或身宫]
+        constexpr auto TIAN_CAI_TIAN_SHOU_TABLE = [] {
+            array<array<uint8_t, 12>, 12> table{};
+            for (int z = 0; z < 12; ++z) {
+                for (int g = 0; g < 12; ++g) {
+                    table[z][g] = u8(rule::tian_cai_tian_shou(static_cast<DiZhi>(z), g, g).first);
+                }
+            }
+            return table;
+        }();
+
+        // 天使天伤：[命宫][是否阳男阴女]
+        constexpr auto TIAN_SHI_TIAN_SHANG_TABLE = [] {
+            array<array<pair<uint8_t, uint8_t>, 2>, 12> table{};
+            for (int g = 0; g < 12; ++g) {
+                // 子年为阳：男命即阳男，女命即阳女
+                auto [shi_ni, shang_ni] = rule::tian_shi_tian_shang(g, false, DiZhi::Zi);
+                auto [shi_shun, shang_shun] = rule::tian_shi_tian_shang(g, true, DiZhi::Zi);
+                table[g][0] = {u8(shi_ni), u8(shang_ni)};
+                table[g][1] = {u8(shi_shun), u8(shang_shun)};
+            }
+            return table;
+        }();
+
+        constexpr auto YANG_TUO_TABLE = [] {
+            array<pair<uint8_t, uint8_t>, 12> table{};
+            for (int lu = 0; lu < 12; ++lu) {
+                auto [yang, tuo] = rule::yang_tuo(lu);
+                table[lu] = {u8(yang), u8(tuo)};
+            }
+            return table;
+        }();
+
+        // 十二神：[五行局 - 2][顺行]、[年干][顺行]、[年支]
+        constexpr auto CHANG_SHENG_12_TABLE = [] {
+            array<array<array<ChangSheng12, 12>, 2>, 5> table{};
+            for (int ju = 0; ju < 5; ++ju) {
+                for (int shun = 0; shun < 2; ++shun) {
+                    table[ju][shun] = rule::chang_sheng_12(static_cast<WuXingJu>(ju + 2), shun == 1, DiZhi::Zi);
+                }
+            }
+            return table;
+        }();
+
+        constexpr auto BO_SHI_12_TABLE = [] {
+            array<array<array<BoShi12, 12>, 2>, 10> table{};
+            for (int g = 0; g < 10; ++g) {
+                for (int shun = 0; shun < 2; ++shun) {
+                    table[g][shun] = rule::bo_shi_12(static_cast<TianGan>(g), DiZhi::Zi, shun == 1);
+                }
+            }
+            return table;
+        }();
+
+        constexpr auto SUI_QIAN_12_TABLE = make_zhi_table([](DiZhi zhi) { return rule::sui_qian_12(zhi); });
+        constexpr auto JIANG_QIAN_12_TABLE = make_zhi_table([](DiZhi zhi) { return rule::jiang_qian_12(zhi); });
+
+        constexpr const MonthStars& month_stars(int lunar_month) {
+            return MONTH_TABLE[fix_index(lunar_month - 1)];
+        }
+
+        constexpr int day_slot(int lunar_day) {
+            return fix_index(lunar_day - 1);
+        }
+
+        // 阳男阴女顺行
+        constexpr int shun_slot(bool is_male, DiZhi year_zhi) {
+            return is_male == (static_cast<int>(year_zhi) % 2 == 0) ? 1 : 0;
+        }
+    }
+
+    // ============= 查找表自检（与安星口诀逐项比对） =============
+
+    static_assert([] {
+        for (int g = 0; g < 10; ++g) {
+            auto gan = static_cast<TianGan>(g);
+            const auto& e = GAN_TABLE[g];
+            auto [yang, tuo] = rule::yang_tuo(get_lu_cun_index(gan));
+            if (pair<int, int>{e.tian_kui, e.tian_yue} != rule::kui_yue(gan) ||
+                e.lu_cun != get_lu_cun_index(gan) || e.qing_yang != yang || e.tuo_luo != tuo ||
+                pair<int, int>{e.tian_guan, e.tian_fu} != rule::tian_guan_tian_fu(gan) ||
+                e.tian_chu != rule::tian_chu(gan) ||
+                pair<int, int>{e.jie_lu, e.kong_wang} != rule::jie_lu_kong_wang(gan)) {
+                return false;
+            }
+            for (int z = 0; z < 12; ++z) {
+                if (XUN_KONG_TABLE[g][z] != rule::xun_kong(gan, static_cast<DiZhi>(z))) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }(), "年干星耀表与口诀不符");
+
+    static_assert([] {
+        for (int z = 0; z < 12; ++z) {
+            auto zhi = static_cast<DiZhi>(z);
+            const auto& e = ZHI_TABLE[z];
+            if (e.tian_ma != rule::tian_ma(zhi) ||
+                pair<int, int>{e.hong_luan, e.tian_xi} != rule::hong_luan_tian_xi(zhi) ||
+                pair<int, int>{e.long_chi, e.feng_ge} != rule::long_chi_feng_ge(zhi) ||
+                e.hua_gai != rule::hua_gai(zhi) || e.xian_chi != rule::xian_chi(zhi) ||
+                pair<int, int>{e.gu_chen, e.gua_su} != rule::gu_chen_gua_su(zhi) ||
+                e.fei_lian != rule::fei_lian(zhi) || e.po_sui != rule::po_sui(zhi) ||
+                pair<int, int>{e.tian_de, e.yue_de} != rule::tian_de_yue_de(zhi) ||
+                e.tian_kong != rule::tian_kong(zhi) ||
+                pair<int, int>{e.tian_ku, e.tian_xu} != rule::tian_ku_tian_xu(zhi) ||
+                e.nian_jie != rule::nian_jie(zhi) ||
+                e.jiang_qian_start != rule::jiang_qian_12_start(zhi) ||
+                SUI_QIAN_12_TABLE[z] != rule::sui_qian_12(zhi) ||
+                JIANG_QIAN_12_TABLE[z] != rule::jiang_qian_12(zhi)) {
+                return false;
+            }
+            for (int h = 0; h < 12; ++h) {
+                auto [huo, ling] = HUO_LING_TABLE[z][h];
+                if (pair<int, int>{huo, ling} != rule::huo_ling(zhi, static_cast<DiZhi>(h))) {
+                    return false;
+                }
+            }
+            for (int g = 0; g < 12; ++g) {
+                auto [cai, shou] = rule::tian_cai_tian_shou(zhi, g, fix_index(g + 5));
+                if (TIAN_CAI_TIAN_SHOU_TABLE[z][g] != cai || TIAN_CAI_TIAN_SHOU_TABLE[z][fix_index(g + 5)] != shou) {
+                    return false;
+                }
+                for (bool is_male : {false, true}) {
+                    auto [shi, shang] = TIAN_SHI_TIAN_SHANG_TABLE[g][shun_slot(is_male, zhi)];
+                    if (pair<int, int>{shi, shang} != rule::tian_shi_tian_shang(g, is_male, zhi)) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }(), "年支星耀表与口诀不符");
+
+    static_assert([] {
+        for (int m = -12; m <= 12; ++m) {
+            if (m == 0) {
+                continue;
+            }
+            const auto& e = month_stars(m);
+            if (pair<int, int>{e.zuo_fu, e.you_bi} != get_zuo_you_index(m)) {
+                return false;
+            }
+            if (m > 0 && (e.tian_xing != rule::tian_xing(m) || e.tian_yao != rule::tian_yao(m) ||
+                          e.jie_shen != rule::jie_shen(m) || e.tian_wu != rule::tian_wu(m) ||
+                          e.tian_yue != rule::tian_yue(m) || e.yin_sha != rule::yin_sha(m))) {
+                return false;
+            }
+            for (int d = 1; d <= 30; ++d) {
+                for (int h = 0; h < 12; ++h) {
+                    auto hour = static_cast<DiZhi>(h);
+                    auto [san_tai, ba_zuo] = SAN_TAI_BA_ZUO_TABLE[fix_index(m - 1)][day_slot(d)];
+                    auto [en_guang, tian_gui] = EN_GUANG_TIAN_GUI_TABLE[h][day_slot(d)];
+                    if (pair<int, int>{san_tai, ba_zuo} != rule::san_tai_ba_zuo(m, d, hour) ||
+                        pair<int, int>{en_guang, tian_gui} != rule::en_guang_tian_gui(m, d, hour)) {
+                        return false;
+                    }
+                }
+            }
+        }
+        for (int h = 0; h < 12; ++h) {
+            auto hour = static_cast<DiZhi>(h);
+            const auto& e = HOUR_TABLE[h];
+            if (pair<int, int>{e.wen_chang, e.wen_qu} != get_chang_qu_index(hour) ||
+                pair<int, int>{e.di_kong, e.di_jie} != rule::kong_jie(hour) ||
+                pair<int, int>{e.tai_fu, e.feng_gao} != rule::tai_fu_feng_gao(hour)) {
+                return false;
+            }
+        }
+        return true;
+    }(), "月、日、时星耀表与口诀不符");
+
+    static_assert([] {
+        for (int z = 0; z < 12; ++z) {
+            auto zhi = static_cast<DiZhi>(z);
+            for (bool is_male : {false, true}) {
+                for (int ju = 2; ju <= 6; ++ju) {
+                    auto wu_xing_ju = static_cast<WuXingJu>(ju);
+                    if (CHANG_SHENG_12_TABLE[ju - 2][shun_slot(is_male, zhi)] != rule::chang_sheng_12(wu_xing_ju, is_male, zhi)) {
+                        return false;
+                    }
+                }
+                for (int g = 0; g < 10; ++g) {
+                    auto gan = static_cast<TianGan>(g);
+                    if (BO_SHI_12_TABLE[g][shun_slot(is_male, zhi)] != rule::bo_shi_12(gan, zhi, is_male)) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }(), "十二神表与口诀不符");
+
+    // 口诀抽查：甲年魁丑钺未、子年红鸾在卯、正月左辅在辰右弼在戌、子时文昌在戌
+    static_assert(GAN_TABLE[0].tian_kui == 11 && GAN_TABLE[0].tian_yue == 5);
+    static_assert(ZHI_TABLE[0].hong_luan == 1 && ZHI_TABLE[0].tian_xi == 7);
+    static_assert(MONTH_TABLE[0].zuo_fu == 2 && MONTH_TABLE[0].you_bi == 8);
+    static_assert(HOUR_TABLE[0].wen_chang == 8 && HOUR_TABLE[0].wen_qu == 2);
+
+    // ============= 辅星、煞星与杂耀定位（查表） =============
+
+    pair<int, int> get_kui_yue_index(TianGan year_gan) {
+        const auto& e = GAN_TABLE[static_cast<int>(year_gan)];
+        return {e.tian_kui, e.tian_yue};
+    }
+
+    pair<int, int> get_yang_tuo_index(int lu_cun_index) {
+        auto [yang, tuo] = YANG_TUO_TABLE[fix_index(lu_cun_index)];
+        return {yang, tuo};
+    }
+
+    pair<int, int> get_huo_ling_index(DiZhi year_zhi, DiZhi hour_zhi) {
+        auto [huo, ling] = HUO_LING_TABLE[static_cast<int>(year_zhi)][static_cast<int>(hour_zhi)];
+        return {huo, ling};
+    }
+
+    pair<int, int> get_kong_jie_index(DiZhi hour_zhi) {
+        const auto& e = HOUR_TABLE[static_cast<int>(hour_zhi)];
+        return {e.di_kong, e.di_jie};
+    }
+
+    int get_tian_ma_index(DiZhi year_zhi) {
+        return ZHI_TABLE[static_cast<int>(year_zhi)].tian_ma;
+    }
+
+    pair<int, int> get_hong_luan_tian_xi_index(DiZhi year_zhi) {
+        const auto& e = ZHI_TABLE[static_cast<int>(year_zhi)];
+        return {e.hong_luan, e.tian_xi};
+    }
+
+    pair<int, int> get_san_tai_ba_zuo_index(int lunar_month, int lunar_day, DiZhi /* hour_zhi */) {
+        auto [san_tai, ba_zuo] = SAN_TAI_BA_ZUO_TABLE[fix_index(lunar_month - 1)][day_slot(lunar_day)];
+        return {san_tai, ba_zuo};
+    }
+
+    pair<int, int> get_en_guang_tian_gui_index(int /* lunar_month */, int lunar_day, DiZhi hour_zhi) {
+        auto [en_guang, tian_gui] = EN_GUANG_TIAN_GUI_TABLE[static_cast<int>(hour_zhi)][day_slot(lunar_day)];
+        return {en_guang, tian_gui};
     }
 
-    /**
-     * @brief 安龙池凤阁诀
-     * 
-     * 口诀：
-     * 龙池从辰宫起子，顺至本生年支安之。
-     * 凤阁从戌宫起子，逆行至本生年支安之。
-     */
     pair<int, int> get_long_chi_feng_ge_index(DiZhi year_zhi) {
-        int zhi_idx = static_cast<int>(year_zhi);
-        int long_chi_index = fix_index(2 + zhi_idx); // 辰宫为2
-        int feng_ge_index = fix_index(8 - zhi_idx);  // 戌宫为8
-        return {long_chi_index, feng_ge_index};
+        const auto& e = ZHI_TABLE[static_cast<int>(year_zhi)];
+        return {e.long_chi, e.feng_ge};
     }
 
-    /**
-     * @brief 安天才天寿诀
-     * 
-     * 口诀：
-     * 天才由命宫起子，顺行至本生年支安之。
-     * 天寿由身宫起子，顺行至本生年支安之。
-     */
     pair<int, int> get_tian_cai_tian_shou_index(DiZhi year_zhi, int ming_index, int shen_index) {
-        int zhi_idx = static_cast<int>(year_zhi);
-        int tian_cai_index = fix_index(ming_index + zhi_idx);
-        int tian_shou_index = fix_index(shen_index + zhi_idx);
-        return {tian_cai_index, tian_shou_index};
+        const auto& row = TIAN_CAI_TIAN_SHOU_TABLE[static_cast<int>(year_zhi)];
+        return {row[fix_index(ming_index)], row[fix_index(shen_index)]};
     }
 
-    /**
-     * @brief 安台辅封诰诀
-     * 
-     * 台辅：午宫起子时，顺数至生时安之
-     * 封诰：寅宫起子时，顺数至生时安之
-     */
     pair<int, int> get_tai_fu_feng_gao_index(DiZhi hour_zhi) {
-        int hour_idx = static_cast<int>(hour_zhi);
-        int tai_fu_index = fix_index(4 + hour_idx);  // 午宫为4
-        int feng_gao_index = fix_index(0 + hour_idx); // 寅宫为0
-        return {tai_fu_index, feng_gao_index};
+        const auto& e = HOUR_TABLE[static_cast<int>(hour_zhi)];
+        return {e.tai_fu, e.feng_gao};
     }
 
-    /**
-     * @brief 安天官天福诀
-     * 
-     * 口诀：
-     * 甲喜羊鸡乙龙猴，丙年蛇鼠一窝谋。
-     * 丁虎擒猪戊玉兔，己鸡居然与虎俦。
-     * 庚猪马辛鸡蛇走，壬犬马癸马蛇游。
-     * 
-     * 说明：前者为天官，后者为天福
-     */
     pair<int, int> get_tian_guan_tian_fu_index(TianGan year_gan) {
-        // 天官天福口诀
-        constexpr array<pair<int, int>, 10> mapping = {
-            pair{5, 7},   // 甲：未酉
-            pair{2, 6},   // 乙：辰申
-            pair{3, 10},  // 丙：巳子
-            pair{0, 9},   // 丁：寅亥
-            pair{1, 1},   // 戊：卯卯
-            pair{7, 0},   // 己：酉寅
-            pair{9, 4},   // 庚：亥午
-            pair{7, 3},   // 辛：酉巳
-            pair{8, 4},   // 壬：戌午
-            pair{4, 3}    // 癸：午巳
-        };
-        return mapping[static_cast<int>(year_gan)];
+        const auto& e = GAN_TABLE[static_cast<int>(year_gan)];
+        return {e.tian_guan, e.tian_fu};
     }
 
-    /**
-     * @brief 安天厨诀
-     * 
-     * 口诀：
-     * 甲丁食蛇口，乙戊辛马方。
-     * 丙从鼠口得，己食于猴房。
-     * 庚食虎头上，壬鸡癸猪堂。
-     */
     int get_tian_chu_index(TianGan year_gan) {
-        // 天厨口诀：甲丁食蛇口，乙戊辛马方...
-        constexpr array<int, 10> mapping = {3, 4, 10, 3, 4, 6, 0, 4, 7, 9};
-        return mapping[static_cast<int>(year_gan)];
+        return GAN_TABLE[static_cast<int>(year_gan)].tian_chu;
     }
 
-    /**
-     * @brief 安华盖诀
-     * 
-     * 口诀：
-     * 寅午戌年在戌，申子辰年在辰，
-     * 巳酉丑年在丑，亥卯未年在未。
-     */
     int get_hua_gai_index(DiZhi year_zhi) {
-        // 华盖口诀
-        if (year_zhi == DiZhi::Yin || year_zhi == DiZhi::Wu || year_zhi == DiZhi::Xu) {
-            return 8; // 戌
-        } else if (year_zhi == DiZhi::Shen || year_zhi == DiZhi::Zi || year_zhi == DiZhi::Chen) {
-            return 2; // 辰
-        } else if (year_zhi == DiZhi::Si || year_zhi == DiZhi::You || year_zhi == DiZhi::Chou) {
-            return 11; // 丑
-        } else { // 亥卯未
-            return 5; // 未
-        }
+        return ZHI_TABLE[static_cast<int>(year_zhi)].hua_gai;
     }
 
-    /**
-     * @brief 安咸池诀
-     * 
-     * 口诀：
-     * 寅午戌年在卯，申子辰年在酉，
-     * 巳酉丑年在午，亥卯未年在子。
-     */
     int get_xian_chi_index(DiZhi year_zhi) {
-        // 咸池口诀
-        if (year_zhi == DiZhi::Yin || year_zhi == DiZhi::Wu || year_zhi == DiZhi::Xu) {
-            return 1; // 卯
-        } else if (year_zhi == DiZhi::Shen || year_zhi == DiZhi::Zi || year_zhi == DiZhi::Chen) {
-            return 7; // 酉
-        } else if (year_zhi == DiZhi::Si || year_zhi == DiZhi::You || year_zhi == DiZhi::Chou) {
-            return 4; // 午
-        } else { // 亥卯未
-            return 10; // 子
-        }
+        return ZHI_TABLE[static_cast<int>(year_zhi)].xian_chi;
     }
 
-    /**
-     * @brief 安孤辰寡宿诀
-     * 
-     * 口诀：
-     * 寅卯辰年安巳丑，巳午未年安申辰，
-     * 申酉戌年安亥未，亥子丑年安寅戌。
-     * 
-     * 说明：前者为孤辰，后者为寡宿
-     */
     pair<int, int> get_gu_chen_gua_su_index(DiZhi year_zhi) {
-        // 孤辰寡宿口诀
-        int gu_chen, gua_su;
-        if (year_zhi == DiZhi::Yin || year_zhi == DiZhi::Mao || year_zhi == DiZhi::Chen) {
-            gu_chen = 3;  // 巳
-            gua_su = 11;  // 丑
-        } else if (year_zhi == DiZhi::Si || year_zhi == DiZhi::Wu || year_zhi == DiZhi::Wei) {
-            gu_chen = 6;  // 申
-            gua_su = 2;   // 辰
-        } else if (year_zhi == DiZhi::Shen || year_zhi == DiZhi::You || year_zhi == DiZhi::Xu) {
-            gu_chen = 9;  // 亥
-            gua_su = 5;   // 未
-        } else { // 亥子丑
-            gu_chen = 0;  // 寅
-            gua_su = 8;   // 戌
-        }
-        return {gu_chen, gua_su};
+        const auto& e = ZHI_TABLE[static_cast<int>(year_zhi)];
+        return {e.gu_chen, e.gua_su};
     }
 
-    /**
-     * @brief 安蜚廉诀
-     * 
-     * 口诀：
-     * 子丑寅年在申酉戌，卯辰巳年在巳午未，
-     * 午未申年在寅卯辰，酉戌亥年在亥子丑。
-     */
     int get_fei_lian_index(DiZhi year_zhi) {
-        // 蜚廉按年支
-        constexpr array<int, 12> mapping = {6, 7, 8, 3, 4, 5, 0, 1, 2, 9, 10, 11};
-        return mapping[static_cast<int>(year_zhi)];
+        return ZHI_TABLE[static_cast<int>(year_zhi)].fei_lian;
     }
 
-    /**
-     * @brief 安破碎诀
-     * 
-     * 口诀：
-     * 子午卯酉年安巳宫，寅申巳亥年安酉宫，
-     * 辰戌丑未年安丑宫。
-     */
     int get_po_sui_index(DiZhi year_zhi) {
-        // 破碎：子午卯酉年在巳，寅申巳亥年在酉，辰戌丑未年在丑
-        int zhi_idx = static_cast<int>(year_zhi);
-        constexpr array<int, 12> mapping = {3, 11, 7, 7, 11, 11, 3, 11, 7, 7, 3, 11};
-        return mapping[zhi_idx];
+        return ZHI_TABLE[static_cast<int>(year_zhi)].po_sui;
     }
 
-    /**
-     * @brief 安天刑诀
-     * 
-     * 口诀：
-     * 天刑从酉起正月，顺至生月便安之。
-     */
     int get_tian_xing_index(int lunar_month) {
-        // 天刑从酉起正月，顺至生月
-        return fix_index(7 + (lunar_month - 1)); // 酉宫为7
+        return month_stars(lunar_month).tian_xing;
     }
 
-    /**
-     * @brief 安天姚诀
-     * 
-     * 口诀：
-     * 天姚丑宫起正月，顺到生月即停留。
-     */
     int get_tian_yao_index(int lunar_month) {
-        // 天姚从丑起正月，顺至生月
-        return fix_index(11 + (lunar_month - 1)); // 丑宫为11
+        return month_stars(lunar_month).tian_yao;
     }
 
-    /**
-     * @brief 安解神诀（月解）
-     * 
-     * 口诀：
-     * 正二在申三四在戌，五六在子七八在寅，
-     * 九十月坐于辰宫，十一十二在午宫。
-     */
     int get_jie_shen_index(int lunar_month) {
-        // 解神（月解）
-        constexpr array<int, 6> positions = {6, 6, 8, 8, 10, 10}; // 申申戌戌子子
-        return positions[(lunar_month - 1) / 2];
+        return month_stars(lunar_month).jie_shen;
     }
 
-    /**
-     * @brief 安天巫诀
-     * 
-     * 口诀：
-     * 正五九月在巳，二六十月在申，
-     * 三七十一在寅，四八十二在亥。
-     */
     int get_tian_wu_index(int lunar_month) {
-        // 天巫：正五九在巳，二六十在申，三七十一在寅，四八十二在亥
-        constexpr array<int, 4> positions = {3, 6, 0, 9}; // 巳申寅亥
-        return positions[(lunar_month - 1) % 4];
+        return month_stars(lunar_month).tian_wu;
     }
 
-    /**
-     * @brief 安天月诀
-     * 
-     * 口诀：
-     * 一犬二蛇三在龙，四虎五羊六兔宫。
-     * 七猪八羊九在虎，十马冬犬腊寅中。
-     */
     int get_tian_yue_index(int lunar_month) {
-        // 天月：一犬二蛇三在龙...
-        constexpr array<int, 12> mapping = {8, 3, 2, 0, 5, 1, 9, 5, 0, 4, 8, 0};
-        return mapping[lunar_month - 1];
+        return month_stars(lunar_month).tian_yue;
     }
 
-    /**
-     * @brief 安阴煞诀
-     * 
-     * 口诀：
-     * 正七月在寅，二八月在子，三九月在戌，
-     * 四十月在申，五十一在午，六十二在辰。
-     */
     int get_yin_sha_index(int lunar_month) {
-        // 阴煞：正七在寅，二八在子，三九在戌...
-        constexpr array<int, 6> positions = {0, 10, 8, 6, 4, 2};
-        return positions[(lunar_month - 1) % 6];
+        return month_stars(lunar_month).yin_sha;
     }
 
-    /**
-     * @brief 安天德月德诀
-     * 
-     * 天德：从酉宫起子年，顺数至生年
-     * 月德：从巳宫起子年，顺数至生年
-     */
     pair<int, int> get_tian_de_yue_de_index(DiZhi year_zhi) {
-        int zhi_idx = static_cast<int>(year_zhi);
-        int tian_de_index = fix_index(7 + zhi_idx);  // 酉宫起
-        int yue_de_index = fix_index(3 + zhi_idx);   // 巳宫起
-        return {tian_de_index, yue_de_index};
+        const auto& e = ZHI_TABLE[static_cast<int>(year_zhi)];
+        return {e.tian_de, e.yue_de};
     }
 
-    /**
-     * @brief 安天空诀
-     * 
-     * 口诀：
-     * 生年支顺数的前一位就是。
-     */
     int get_tian_kong_index(DiZhi year_zhi) {
-        // 天空：生年支顺数前一位
-        return fix_index(static_cast<int>(year_zhi) + 1);
+        return ZHI_TABLE[static_cast<int>(year_zhi)].tian_kong;
     }
 
-    /**
-     * @brief 安旬空诀
-     * 
-     * 算法：
-     * 从生年地支顺数，加上（9-年干序号）再加1
-     * 若阴阳属性不同，再加1
-     */
     int get_xun_kong_index(TianGan year_gan, DiZhi year_zhi) {
-        // 旬空计算
-        int gan_idx = static_cast<int>(year_gan);
-        int zhi_idx = static_cast<int>(year_zhi);
-        int xun_kong_idx = fix_index(zhi_idx + (9 - gan_idx) + 1);
-        
-        // 阴阳属性检查
-        if ((zhi_idx % 2) != (xun_kong_idx % 2)) {
-            xun_kong_idx = fix_index(xun_kong_idx + 1);
-        }
-        
-        return xun_kong_idx;
+        return XUN_KONG_TABLE[static_cast<int>(year_gan)][static_cast<int>(year_zhi)];
     }
 
-    /**
-     * @brief 安截路空亡诀
-     * 
-     * 口诀：
-     * 甲己之年申酉，乙庚之年午未，
-     * 丙辛之年辰巳，丁壬之年寅卯，
-     * 戊癸之年子丑。
-     * 
-     * 说明：前者为截路，后者为空亡
-     */
     pair<int, int> get_jie_lu_kong_wang_index(TianGan year_gan) {
-        // 截路空亡
-        constexpr array<pair<int, int>, 5> mapping = {
-            pair{6, 7},   // 甲己：申酉
-            pair{4, 5},   // 乙庚：午未
-            pair{2, 3},   // 丙辛：辰巳
-            pair{0, 1},   // 丁壬：寅卯
-            pair{10, 11}  // 戊癸：子丑
-        };
-        return mapping[static_cast<int>(year_gan) % 5];
+        const auto& e = GAN_TABLE[static_cast<int>(year_gan)];
+        return {e.jie_lu, e.kong_wang};
     }
 
-    /**
-     * @brief 安天哭天虚诀
-     * 
-     * 口诀：
-     * 天哭天虚起午宫，午宫起子两分踪，
-     * 哭逆行兮虚顺转，数到生年便停留。
-     * 
-     * 说明：天哭从午宫起子年逆数，天虚从午宫起子年顺数
-     */
     pair<int, int> get_tian_ku_tian_xu_index(DiZhi year_zhi) {
-        int zhi_idx = static_cast<int>(year_zhi);
-        int tian_ku_index = fix_index(4 - zhi_idx);  // 午宫起逆数
-        int tian_xu_index = fix_index(4 + zhi_idx);  // 午宫起顺数
-        return {tian_ku_index, tian_xu_index};
+        const auto& e = ZHI_TABLE[static_cast<int>(year_zhi)];
+        return {e.tian_ku, e.tian_xu};
     }
 
-    /**
-     * @brief 安天使天伤诀
-     * 
-     * 口诀：
-     * 天伤奴仆、天使疾厄、夹迁移宫最易寻得。
-     * 凡阳男阴女，皆依此诀，但若为阴男阳女，
-     * 则改为天伤居疾厄、天使居奴仆。
-     * 
-     * 说明：夹迁移宫，阳男阴女天伤在迁移后一位、天使在迁移前一位
-     */
     pair<int, int> get_tian_shi_tian_shang_index(int ming_index, bool is_male, DiZhi year_zhi) {
-        // 天使天伤：夹迁移宫
-        int qian_yi_index = fix_index(ming_index + 6); // 迁移宫在命宫对宫
-        
-        // 阳男阴女：天伤在奴仆(迁移后一位)，天使在疾厄(迁移前一位)
-        // 阴男阳女：相反
-        int zhi_idx = static_cast<int>(year_zhi);
-        bool yang_zhi = (zhi_idx % 2 == 0);
-        bool same_yin_yang = (is_male == yang_zhi);
-        
-        int tian_shi_index, tian_shang_index;
-        if (same_yin_yang) {
-            tian_shang_index = fix_index(qian_yi_index + 1);
-            tian_shi_index = fix_index(qian_yi_index - 1);
-        } else {
-            tian_shi_index = fix_index(qian_yi_index + 1);
-            tian_shang_index = fix_index(qian_yi_index - 1);
-        }
-        
-        return {tian_shi_index, tian_shang_index};
+        auto [shi, shang] = TIAN_SHI_TIAN_SHANG_TABLE[fix_index(ming_index)][shun_slot(is_male, year_zhi)];
+        return {shi, shang};
     }
 
-    /**
-     * @brief 安年解诀
-     * 
-     * 口诀：
-     * 解神从戌上起子，逆数至当生年太岁上是也。
-     */
     int get_nian_jie_index(DiZhi year_zhi) {
-        // 年解：从戌起子，逆数至当生年太岁
-        constexpr array<int, 12> mapping = {8, 7, 6, 5, 4, 3, 2, 1, 0, 11, 10, 9};
-        return mapping[static_cast<int>(year_zhi)];
+        return ZHI_TABLE[static_cast<int>(year_zhi)].nian_jie;
     }
 
-    // ============= 长生12神和博士12神 =============
+    // ============= 十二神（查表） =============
 
-    /**
-     * @brief 获取长生12神起始位置
-     * 
-     * 口诀：
-     * 水二局长生在申，木三局长生在亥，
-     * 金四局长生在巳，土五局长生在申，
-     * 火六局长生在寅。
-     */
     int get_chang_sheng_12_start_index(WuXingJu wu_xing_ju) {
-        switch (wu_xing_ju) {
-            case WuXingJu::ShuiErJu:
-                return 6; // 申
-            case WuXingJu::MuSanJu:
-                return 9; // 亥
-            case WuXingJu::JinSiJu:
-                return 3; // 巳
-            case WuXingJu::TuWuJu:
-                return 6; // 申
-            case WuXingJu::HuoLiuJu:
-                return 0; // 寅
-            default:
-                return 0;
-        }
+        return rule::chang_sheng_12_start(wu_xing_ju);
     }
 
-    /**
-     * @brief 安长生12神
-     * 
-     * 口诀：
-     * 阳男阴女顺行，阴男阳女逆行，
-     * 安长生、沐浴、冠带、临官、帝旺、衰、
-     * 病、死、墓、绝、胎、养。
-     */
     array<ChangSheng12, 12> arrange_chang_sheng_12(
         WuXingJu wu_xing_ju,
         bool is_male,
         DiZhi year_zhi
     ) {
-        array<ChangSheng12, 12> result{};
-        
-        constexpr array<ChangSheng12, 12> shun_xu = {
-            ChangSheng12::ChangSheng, ChangSheng12::MuYu, ChangSheng12::GuanDai,
-            ChangSheng12::LinGuan, ChangSheng12::DiWang, ChangSheng12::Shuai,
-            ChangSheng12::Bing, ChangSheng12::Si, ChangSheng12::Mu,
-            ChangSheng12::Jue, ChangSheng12::Tai, ChangSheng12::Yang
-        };
-        
-        int start_idx = get_chang_sheng_12_start_index(wu_xing_ju);
-        
-        // 判断阴阳：阳男阴女顺行，阴男阳女逆行
-        int zhi_idx = static_cast<int>(year_zhi);
-        bool yang_zhi = (zhi_idx % 2 == 0);
-        bool shun_xing = (is_male == yang_zhi);
-        
-        for (int i = 0; i < 12; ++i) {
-            int idx = shun_xing 
-                ? fix_index(start_idx + i) 
-                : fix_index(start_idx - i);
-            result[idx] = shun_xu[i];
-        }
-        
-        return result;
+        return CHANG_SHENG_12_TABLE[static_cast<int>(wu_xing_ju) - 2][shun_slot(is_male, year_zhi)];
     }
 
-    /**
-     * @brief 安博士12神
-     * 
-     * 口诀：
-     * 从禄存起，阳男阴女顺行，阴男阳女逆行。
-     * 安博士、力士、青龙、小耗、将军、奏书、
-     * 飞廉、喜神、病符、大耗、伏兵、官府。
-     */
     array<BoShi12, 12> arrange_bo_shi_12(
         TianGan year_gan,
         DiZhi year_zhi,
         bool is_male
     ) {
-        array<BoShi12, 12> result{};
-        
-        constexpr array<BoShi12, 12> shun_xu = {
-            BoShi12::BoShi, BoShi12::LiShi, BoShi12::QingLong,
-            BoShi12::XiaoHao2, BoShi12::JiangJun, BoShi12::ZouShu,
-            BoShi12::FeiLian2, BoShi12::XiShen2, BoShi12::BingFu2,
-            BoShi12::DaHao2, BoShi12::FuBing, BoShi12::GuanFu2
-        };
-        
-        // 从禄存起
-        int lu_cun_idx = get_lu_cun_index(year_gan);
-        
-        // 阳男阴女顺行，阴男阳女逆行
-        int zhi_idx = static_cast<int>(year_zhi);
-        bool yang_zhi = (zhi_idx % 2 == 0);
-        bool shun_xing = (is_male == yang_zhi);
-        
-        for (int i = 0; i < 12; ++i) {
-            int idx = shun_xing 
-                ? fix_index(lu_cun_idx + i) 
-                : fix_index(lu_cun_idx - i);
-            result[idx] = shun_xu[i];
-        }
-        
-        return result;
+        return BO_SHI_12_TABLE[static_cast<int>(year_gan)][shun_slot(is_male, year_zhi)];
     }
 
-    // ============= 流年诸星 =============
-
-    /**
-     * @brief 获取将前12神起始位置
-     * 
-     * 口诀：
-     * 寅午戌年将星午，申子辰年子将星，
-     * 巳酉丑将酉上驻，亥卯未将卯上停。
-     */
     int get_jiang_qian_12_start_index(DiZhi year_zhi) {
-        // 寅午戌年将星午，申子辰年子将星，巳酉丑将酉上驻，亥卯未将卯上停
-        if (year_zhi == DiZhi::Yin || year_zhi == DiZhi::Wu || year_zhi == DiZhi::Xu) {
-            return 4; // 午
-        } else if (year_zhi == DiZhi::Shen || year_zhi == DiZhi::Zi || year_zhi == DiZhi::Chen) {
-            return 10; // 子
-        } else if (year_zhi == DiZhi::Si || year_zhi == DiZhi::You || year_zhi == DiZhi::Chou) {
-            return 7; // 酉
-        } else { // 亥卯未
-            return 1; // 卯
-        }
+        return ZHI_TABLE[static_cast<int>(year_zhi)].jiang_qian_start;
     }
 
-    /**
-     * @brief 安流年岁前12神
-     * 
-     * 口诀：
-     * 流年地支起岁建，岁前首先是晦气，
-     * 丧门贯索及官符，小耗大耗龙德继，
-     * 白虎天德连吊客，病符居后须当记。
-     */
     array<SuiQian12, 12> arrange_sui_qian_12(DiZhi year_zhi) {
-        array<SuiQian12, 12> result{};
-        
-        constexpr array<SuiQian12, 12> shun_xu = {
-            SuiQian12::SuiJian, SuiQian12::HuiQi, SuiQian12::SangMen,
-            SuiQian12::GuanSuo, SuiQian12::GuanFu, SuiQian12::XiaoHao,
-            SuiQian12::DaHao, SuiQian12::LongDe, SuiQian12::BaiHu,
-            SuiQian12::TianDe2, SuiQian12::DiaoKe, SuiQian12::BingFu
-        };
-        
-        int zhi_idx = static_cast<int>(year_zhi);
-        int start_idx = di_zhi_to_index(year_zhi);
-        
-        for (int i = 0; i < 12; ++i) {
-            int idx = fix_index(start_idx + i);
-            result[idx] = shun_xu[i];
-        }
-        
-        return result;
+        return SUI_QIAN_12_TABLE[static_cast<int>(year_zhi)];
     }
 
-    /**
-     * @brief 安流年将前12神
-     * 
-     * 口诀：
-     * 攀鞍岁驿并息神，华盖劫煞灾煞轻，
-     * 天煞指背咸池续，月煞亡神次第行。
-     */
     array<JiangQian12, 12> arrange_jiang_qian_12(DiZhi year_zhi) {
-        array<JiangQian12, 12> result{};
-        
-        constexpr array<JiangQian12, 12> shun_xu = {
-            JiangQian12::JiangXing, JiangQian12::PanAn, JiangQian12::SuiYi,
-            JiangQian12::XiShen, JiangQian12::HuaGai2, JiangQian12::JieSha,
-            JiangQian12::ZaiSha, JiangQian12::TianSha, JiangQian12::ZhiBei,
-            JiangQian12::XianChi2, JiangQian12::YueSha, JiangQian12::WangShen
-        };
-        
-        int start_idx = get_jiang_qian_12_start_index(year_zhi);
-        
-        for (int i = 0; i < 12; ++i) {
-            int idx = fix_index(start_idx + i);
-            result[idx] = shun_xu[i];
-        }
-        
+        return JIANG_QIAN_12_TABLE[static_cast<int>(year_zhi)];
+    }
+
+    // ============= 一次查表安诸星 =============
+
+    MinorStarPositions place_minor_stars(
+        TianGan year_gan,
+        DiZhi year_zhi,
+        int lunar_month,
+        int lunar_day,
+        DiZhi hour_zhi,
+        int ming_index,
+        int shen_index,
+        WuXingJu wu_xing_ju,
+        bool is_male
+    ) {
+        using enum ZaYao;
+        const int g = static_cast<int>(year_gan);
+        const int z = static_cast<int>(year_zhi);
+        const int h = static_cast<int>(hour_zhi);
+        const int m = fix_index(lunar_month - 1);
+        const int d = day_slot(lunar_day);
+        const int shun = shun_slot(is_male, year_zhi);
+
+        const GanStars& gs = GAN_TABLE[g];
+        const ZhiStars& zs = ZHI_TABLE[z];
+        const MonthStars& ms = MONTH_TABLE[m];
+        const HourStars& hs = HOUR_TABLE[h];
+        const auto [huo, ling] = HUO_LING_TABLE[z][h];
+        const auto [san_tai, ba_zuo] = SAN_TAI_BA_ZUO_TABLE[m][d];
+        const auto [en_guang, tian_gui] = EN_GUANG_TIAN_GUI_TABLE[h][d];
+        const auto [tian_shi, tian_shang] = TIAN_SHI_TIAN_SHANG_TABLE[fix_index(ming_index)][shun];
+
+        MinorStarPositions result{};
+        result.fu_xing_gong = {ms.zuo_fu, ms.you_bi, hs.wen_chang, hs.wen_qu, gs.tian_kui, gs.tian_yue};
+        result.sha_xing_gong = {gs.qing_yang, gs.tuo_luo, huo, ling, hs.di_kong, hs.di_jie};
+        result.lu_cun_gong = gs.lu_cun;
+        result.tian_ma_gong = zs.tian_ma;
+
+        auto& za = result.za_yao_gong;
+        auto place = [&za](ZaYao star, uint8_t gong) { za[static_cast<int>(star)] = gong; };
+        place(HongLuan, zs.hong_luan);
+        place(TianXi, zs.tian_xi);
+        place(TianYao, ms.tian_yao);
+        place(XianChi, zs.xian_chi);
+        place(JieShen, ms.jie_shen);
+        place(TianWu, ms.tian_wu);
+        place(TianGuan, gs.tian_guan);
+        place(TianFu2, gs.tian_fu);
+        place(TianChu, gs.tian_chu);
+        place(SanTai, san_tai);
+        place(BaZuo, ba_zuo);
+        place(EnGuang, en_guang);
+        place(TianGui, tian_gui);
+        place(LongChi, zs.long_chi);
+        place(FengGe, zs.feng_ge);
+        place(TianCai, TIAN_CAI_TIAN_SHOU_TABLE[z][fix_index(ming_index)]);
+        place(TianShou, TIAN_CAI_TIAN_SHOU_TABLE[z][fix_index(shen_index)]);
+        place(TaiFu, hs.tai_fu);
+        place(FengGao, hs.feng_gao);
+        place(HuaGai, zs.hua_gai);
+        place(TianYue2, ms.tian_yue);
+        place(TianDe, zs.tian_de);
+        place(YueDe, zs.yue_de);
+        place(GuChen, zs.gu_chen);
+        place(GuaSu, zs.gua_su);
+        place(FeiLian, zs.fei_lian);
+        place(PoSui, zs.po_sui);
+        place(TianXing, ms.tian_xing);
+        place(YinSha, ms.yin_sha);
+        place(TianKong2, zs.tian_kong);
+        place(XunKong, XUN_KONG_TABLE[g][z]);
+        place(JieLu, gs.jie_lu);
+        place(KongWang, gs.kong_wang);
+        place(TianKu, zs.tian_ku);
+        place(TianXu, zs.tian_xu);
+        place(TianShi, tian_shi);
+        place(TianShang, tian_shang);
+        place(NianJie, zs.nian_jie);
+
+        result.chang_sheng_12 = CHANG_SHENG_12_TABLE[static_cast<int>(wu_xing_ju) - 2][shun];
+        result.bo_shi_12 = BO_SHI_12_TABLE[g][shun];
+        result.sui_qian_12 = SUI_QIAN_12_TABLE[z];
+        result.jiang_qian_12 = JIANG_QIAN_12_TABLE[z];
         return result;
     }
 
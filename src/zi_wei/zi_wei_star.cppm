@@ -35,6 +35,11 @@ export namespace ZhouYi::ZiWei {
         return fix_index(zi_wei_index + 6);
     }
 
+    /**
+     * @brief 安十四主星（按 ZhuXing 顺序返回所在宫索引，不分配内存）
+     */
+    array<int, 14> get_zhu_xing_positions(int zi_wei_index);
+
     /**
      * @brief 安紫微星系（北斗星系）
      */
@@ -90,6 +95,16 @@ export namespace ZhouYi::ZiWei {
      */
     map<ZhuXing, SiHua> get_si_hua_table(TianGan year_gan);
 
+    /**
+     * @brief 年干四化所化主星（按禄权科忌顺序返回 ZhuXing 数值，-1 表示不落主星）
+     */
+    array<int, 4> get_si_hua_xing(TianGan year_gan);
+
+    /**
+     * @brief 安天马（按年支）
+     */
+    int get_tian_ma_index(DiZhi year_zhi);
+
     // ============= 杂耀星定位算法 =============
 
     /**
@@ -264,4 +279,38 @@ export namespace ZhouYi::ZiWei {
      */
     array<JiangQian12, 12> arrange_jiang_qian_12(DiZhi year_zhi);
 
+    // ============= 一次查表安诸星 =============
+
+    /**
+     * @brief 辅星、煞星、杂耀与十二神的安星结果（宫位索引以寅宫为0）
+     */
+    struct MinorStarPositions {
+        array<uint8_t, static_cast<size_t>(FuXing::COUNT)> fu_xing_gong;     // 按 FuXing 顺序
+        array<uint8_t, static_cast<size_t>(ShaXing::COUNT)> sha_xing_gong;   // 按 ShaXing 顺序
+        uint8_t lu_cun_gong;                                                 // 禄存
+        uint8_t tian_ma_gong;                                                // 天马
+        array<uint8_t, static_cast<size_t>(ZaYao::COUNT)> za_yao_gong;       // 按 ZaYao 顺序
+        array<ChangSheng12, 12> chang_sheng_12;                              // 各宫所临长生12神
+        array<BoShi12, 12> bo_shi_12;                                        // 各宫所临博士12神
+        array<SuiQian12, 12> sui_qian_12;                                    // 各宫所临岁前12神
+        array<JiangQian12, 12> jiang_qian_12;                                // 各宫所临将前12神
+    };
+
+    /**
+     * @brief 按年干、年支、农历月日、时辰一次查表安全部辅星杂耀
+     *
+     * 各星宫位取自编译期生成的查找表，与上列单星函数结果一致。
+     */
+    MinorStarPositions place_minor_stars(
+        TianGan year_gan,
+        DiZhi year_zhi,
+        int lunar_month,
+        int lunar_day,
+        DiZhi hour_zhi,
+        int ming_index,
+        int shen_index,
+        WuXingJu wu_xing_ju,
+        bool is_male
+    );
+
 } // namespace ZhouYi::ZiWei
@@ -3,6 +3,7 @@ export module ZhouYi.ZiWei.StarDescription;
 
 import std;
 import ZhouYi.ZiWei.Constants;
+import ZhouYi.ZiWei.StarMask;
 import ZhouYi.ZhMapper;
 
 export namespace ZhouYi::ZiWei {
@@ -64,10 +65,20 @@ export namespace ZhouYi::ZiWei {
     };
 
     /**
-     * @brief 获取星耀特性信息
+     * @brief 获取星耀特性信息（未收录的星耀返回“未知”信息）
      */
     XingYaoInfo get_xing_yao_info(const string& star_name);
 
+    /**
+     * @brief 按星耀编号获取特性信息
+     */
+    XingYaoInfo get_xing_yao_info(StarId id);
+
+    /**
+     * @brief 按星耀编号判断特性（直接查常量表，不分配内存）
+     */
+    bool has_xing_yao_te_xing(StarId id, XingYaoTeXing te_xing);
+
     /**
      * @brief 判断是否桃花星
      */
@@ -0,0 +1,63 @@
+// 紫微斗数星耀位掩码模块（实现）
+module ZhouYi.ZiWei.StarMask;
+
+import ZhouYi.ZiWei.Constants;
+import std;
+import ZhouYi.ZhMapper;
+
+namespace ZhouYi::ZiWei {
+    using namespace std;
+
+    namespace {
+        constexpr auto STAR_NAMES = ZhouYi::Mapper::ZhMap<StarId>::get_map();
+    }
+
+    string_view star_name(StarId id) {
+        return STAR_NAMES[static_cast<size_t>(id)];
+    }
+
+    optional<StarId> star_id_from_name(string_view name) {
+        static const unordered_map<string_view, StarId> index = [] {
+            unordered_map<string_view, StarId> result;
+            for (size_t i = 0; i < STAR_NAMES.size(); ++i) {
+                result.emplace(STAR_NAMES[i], static_cast<StarId>(i));
+            }
+            return result;
+        }();
+
+        if (auto it = index.find(name); it != index.end()) {
+            return it->second;
+        }
+        return nullopt;
+    }
+
+    vector<string> StarMask::to_names() const {
+        vector<string> names;
+        names.reserve(count());
+        for (size_t i = 0; i < STAR_NAMES.size(); ++i) {
+            if (test(static_cast<StarId>(i))) {
+                names.emplace_back(STAR_NAMES[i]);
+            }
+        }
+        return names;
+    }
+
+    StarMask StarMask::from_names(const vector<string>& names) {
+        StarMask mask;
+        for (const auto& name : names) {
+            if (auto id = star_id_from_name(name); id.has_value()) {
+                mask.set(*id);
+            }
+        }
+        return mask;
+    }
+
+    GongStarMasks to_gong_star_masks(const array<vector<string>, 12>& stars_in_gong) {
+        GongStarMasks masks{};
+        for (int i = 0; i < 12; ++i) {
+            masks[i] = StarMask::from_names(stars_in_gong[i]);
+        }
+        return masks;
+    }
+
+} // namespace ZhouYi::ZiWei
@@ -0,0 +1,218 @@
+// 紫微斗数星耀位掩码模块
+export module ZhouYi.ZiWei.StarMask;
+
+import std;
+import ZhouYi.ZiWei.Constants;
+import ZhouYi.ZhMapper;
+
+export namespace ZhouYi::ZiWei {
+    using namespace std;
+
+    /**
+     * @brief 统一星耀编号
+     *
+     * 将主星、辅星、煞星、禄存天马、四化标记与杂耀排入同一编号空间，
+     * 每个编号对应 StarMask 中的一位。各分段顺序与原枚举一致。
+     */
+    enum class StarId : uint8_t {
+        // 十四正曜（与 ZhuXing 同序）
+        ZiWei = 0, TianJi, TaiYang, WuQu, TianTong, LianZhen,
+        TianFu, TaiYin, TanLang, JuMen, TianXiang, TianLiang, QiSha, PoJun,
+
+        // 六吉星（与 FuXing 同序）
+        ZuoFu, YouBi, WenChang, WenQu, TianKui, TianYue,
+
+        // 六煞星（与 ShaXing 同序）
+        QingYang, TuoLuo, HuoXing, LingXing, DiKong, DiJie,
+
+        // 禄存、天马
+        LuCun, TianMa,
+
+        // 四化标记（与 SiHua 同序）
+        HuaLu, HuaQuan, HuaKe, HuaJi,
+
+        // 杂耀起始编号（其后按 ZaYao 顺序排列）
+        ZaYaoBegin,
+
+        COUNT = ZaYaoBegin + static_cast<int>(ZaYao::COUNT)
+    };
+
+    constexpr StarId to_star_id(ZhuXing xing) {
+        return static_cast<StarId>(static_cast<int>(StarId::ZiWei) + static_cast<int>(xing));
+    }
+
+    constexpr StarId to_star_id(FuXing xing) {
+        return static_cast<StarId>(static_cast<int>(StarId::ZuoFu) + static_cast<int>(xing));
+    }
+
+    constexpr StarId to_star_id(ShaXing xing) {
+        return static_cast<StarId>(static_cast<int>(StarId::QingYang) + static_cast<int>(xing));
+    }
+
+    constexpr StarId to_star_id(SiHua hua) {
+        return static_cast<StarId>(static_cast<int>(StarId::HuaLu) + static_cast<int>(hua));
+    }
+
+    constexpr StarId to_star_id(ZaYao yao) {
+        return static_cast<StarId>(static_cast<int>(StarId::ZaYaoBegin) + static_cast<int>(yao));
+    }
+
+    /**
+     * @brief 星耀中文名称
+     */
+    string_view star_name(StarId id);
+
+    /**
+     * @brief 从中文名称查找星耀编号
+     * @return 未收录的名称返回 nullopt
+     */
+    optional<StarId> star_id_from_name(string_view name);
+
+    /**
+     * @brief 单宫星耀占位掩码（128 位）
+     *
+     * 每个 StarId 占一位，格局判断中的“宫内有某些星”“三方有某星”
+     * 均化为按位与/比较，不再做字符串查找。
+     */
+    struct StarMask {
+        uint64_t lo = 0;
+        uint64_t hi = 0;
+
+        constexpr StarMask() = default;
+
+        constexpr StarMask(initializer_list<StarId> ids) {
+            for (auto id : ids) {
+                set(id);
+            }
+        }
+
+        constexpr void set(StarId id) {
+            auto bit = static_cast<unsigned>(id);
+            if (bit < 64) {
+                lo |= uint64_t{1} << bit;
+            } else {
+                hi |= uint64_t{1} << (bit - 64);
+            }
+        }
+
+        constexpr bool test(StarId id) const {
+            auto bit = static_cast<unsigned>(id);
+            return bit < 64 ? (lo >> bit) & 1 : (hi >> (bit - 64)) & 1;
+        }
+
+        /**
+         * @brief 是否包含 other 中的全部星耀
+         */
+        constexpr bool contains_all(const StarMask& other) const {
+            return (lo & other.lo) == other.lo && (hi & other.hi) == other.hi;
+        }
+
+        /**
+         * @brief 是否包含 other 中的任一星耀
+         */
+        constexpr bool contains_any(const StarMask& other) const {
+            return ((lo & other.lo) | (hi & other.hi)) != 0;
+        }
+
+        constexpr bool any() const {
+            return (lo | hi) != 0;
+        }
+
+        constexpr int count() const {
+            return popcount(lo) + popcount(hi);
+        }
+
+        constexpr StarMask operator|(const StarMask& other) const {
+            StarMask result;
+            result.lo = lo | other.lo;
+            result.hi = hi | other.hi;
+            return result;
+        }
+
+        constexpr StarMask operator&(const StarMask& other) const {
+            StarMask result;
+            result.lo = lo & other.lo;
+            result.hi = hi & other.hi;
+            return result;
+        }
+
+        constexpr StarMask& operator|=(const StarMask& other) {
+            lo |= other.lo;
+            hi |= other.hi;
+            return *this;
+        }
+
+        constexpr bool operator==(const StarMask&) const = default;
+
+        /**
+         * @brief 按 StarId 顺序列出星耀名称
+         */
+        vector<string> to_names() const;
+
+        /**
+         * @brief 由星耀名称列表构建掩码（未收录的名称忽略）
+         */
+        static StarMask from_names(const vector<string>& names);
+    };
+
+    static_assert(static_cast<int>(StarId::COUNT) <= 128, "StarMask 仅有 128 位");
+
+    /**
+     * @brief 十四正曜
+     */
+    inline constexpr StarMask ZHENG_YAO_MASK{
+        StarId::ZiWei, StarId::TianJi, StarId::TaiYang, StarId::WuQu, StarId::TianTong, StarId::LianZhen,
+        StarId::TianFu, StarId::TaiYin, StarId::TanLang, StarId::JuMen, StarId::TianXiang, StarId::TianLiang,
+        StarId::QiSha, StarId::PoJun
+    };
+
+    /**
+     * @brief 夹宫吉星（左辅右弼、文昌文曲、天魁天钺、禄存）
+     */
+    inline constexpr StarMask JI_XING_MASK{
+        StarId::ZuoFu, StarId::YouBi, StarId::WenChang, StarId::WenQu,
+        StarId::TianKui, StarId::TianYue, StarId::LuCun
+    };
+
+    /**
+     * @brief 夹宫煞星（擎羊陀罗、火星铃星、地空地劫）
+     */
+    inline constexpr StarMask SHA_XING_MASK{
+        StarId::QingYang, StarId::TuoLuo, StarId::HuoXing,
+        StarId::LingXing, StarId::DiKong, StarId::DiJie
+    };
+
+    /**
+     * @brief 十二宫星耀掩码
+     */
+    using GongStarMasks = array<StarMask, 12>;
+
+    /**
+     * @brief 由十二宫星耀名称列表构建掩码
+     */
+    GongStarMasks to_gong_star_masks(const array<vector<string>, 12>& stars_in_gong);
+
+} // namespace ZhouYi::ZiWei
+
+// ZhMapper 特化定义
+namespace ZhouYi::Mapper {
+    using namespace ZhouYi::ZiWei;
+
+    // 星耀编号中文映射（由各分段映射表拼接）
+    template<>
+    struct ZhMap<StarId> {
+        static constexpr auto get_map() {
+            std::array<std::string_view, static_cast<std::size_t>(StarId::COUNT)> result{};
+            std::size_t pos = 0;
+            for (auto name : ZhMap<ZhuXing>::get_map()) result[pos++] = name;
+            for (auto name : ZhMap<FuXing>::get_map()) result[pos++] = name;
+            for (auto name : ZhMap<ShaXing>::get_map()) result[pos++] = name;
+            result[pos++] = "禄存"sv;
+            result[pos++] = "天马"sv;
+            for (auto name : ZhMap<SiHua>::get_map()) result[pos++] = name;
+            for (auto name : ZhMap<ZaYao>::get_map()) result[pos++] = name;
+            return result;
+        }
+    };
+
+} // namespace ZhouYi::Mapper
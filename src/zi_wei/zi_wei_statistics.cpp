@@ -0,0 +1,194 @@
+// 紫微斗数格局人口统计模块（实现）
+module ZhouYi.ZiWei.Statistics;
+
+import ZhouYi.GanZhi;
+import ZhouYi.ZiWei.Constants;
+import ZhouYi.ZiWei.GeJu;
+import ZhouYi.ZiWei.StarMask;
+import ZhouYi.ZiWei.ChartTable;
+import ZhouYi.ZiWei.Chart;
+import ZhouYi.ZiWei;
+import ZhouYi.tyme;
+import fmt;
+import std;
+
+namespace ZhouYi::ZiWei {
+    using namespace std;
+    using namespace ZhouYi::GanZhi;
+
+    namespace {
+        constexpr size_t DAY_CHUNK = 8;         // 第一阶段每块天数
+        constexpr size_t KEY_CHUNK = 2048;      // 第二阶段每块表键数
+
+        /**
+         * @brief 由工作线程领取 [0, count) 的小块任务
+         *
+         * 各线程从共享计数器取下一块，先做完的线程自然多取，负载随之均衡。
+         * @param body body(begin, end, worker) 处理一块
+         */
+        template <typename F>
+        void parallel_for_chunks(size_t count, size_t chunk, unsigned threads, F&& body) {
+            atomic<size_t> next{0};
+            auto work = [&](unsigned worker) {
+                for (size_t begin = next.fetch_add(chunk, memory_order_relaxed); begin < count;
+                     begin = next.fetch_add(chunk, memory_order_relaxed)) {
+                    body(begin, min(begin + chunk, count), worker);
+                }
+            };
+
+            vector<jthread> pool;
+            pool.reserve(threads - 1);
+            for (unsigned worker = 1; worker < threads; ++worker) {
+                pool.emplace_back(work, worker);
+            }
+            work(0);
+        }
+
+        /**
+         * @brief 时辰对应的代表钟点（子时取 0 点，其余取时辰首个整点）
+         */
+        constexpr int shi_chen_hour(int shi_chen) {
+            return shi_chen == 0 ? 0 : shi_chen * 2 - 1;
+        }
+
+        /**
+         * @brief 分析一张命盘并按权重计入统计
+         */
+        void accumulate_chart(GeJuStatistics& stats, const ZiWeiChart& chart, uint64_t weight) {
+            array<DiZhi, 12> gong_di_zhi{};
+            for (int i = 0; i < 12; ++i) {
+                const auto& palace = chart.palaces[i];
+                gong_di_zhi[i] = palace.di_zhi;
+                for (const auto& star : palace.get_stars()) {
+                    stats.star_in_gong[static_cast<size_t>(star.id)][static_cast<size_t>(palace.gong_wei)] += weight;
+                }
+            }
+
+            GeJuAnalyzer analyzer(chart.get_star_masks(), gong_di_zhi, chart.ming_gong_index);
+
+            int total_score = 0;
+            for (const auto& ge_ju : analyzer.analyze_all()) {
+                auto type = static_cast<size_t>(ge_ju.type);
+                stats.ge_ju_counts[type] += weight;
+                if (stats.ge_ju_names[type].empty()) {
+                    stats.ge_ju_names[type] = ge_ju.name;
+                }
+                total_score += ge_ju.score;
+            }
+            for (const auto& shuang_xing : analyzer.analyze_shuang_xing()) {
+                stats.shuang_xing_counts[static_cast<size_t>(shuang_xing.type)] += weight;
+            }
+
+            stats.score_histogram[GeJuStatistics::score_bucket(total_score)] += weight;
+            stats.score_sum += static_cast<int64_t>(total_score) * static_cast<int64_t>(weight);
+            stats.chart_count += weight;
+            stats.distinct_chart_count++;
+        }
+    }
+
+    // ============= GeJuStatistics =============
+
+    size_t GeJuStatistics::score_bucket(int score) {
+        score = clamp(score, SCORE_MIN, SCORE_MAX);
+        return static_cast<size_t>((score - SCORE_MIN) / SCORE_BUCKET);
+    }
+
+    void GeJuStatistics::merge(const GeJuStatistics& other) {
+        chart_count += other.chart_count;
+        distinct_chart_count += other.distinct_chart_count;
+        score_sum += other.score_sum;
+        for (size_t i = 0; i < GE_JU_TYPE_COUNT; ++i) {
+            ge_ju_counts[i] += other.ge_ju_counts[i];
+            if (ge_ju_names[i].empty()) {
+                ge_ju_names[i] = other.ge_ju_names[i];
+            }
+        }
+        for (size_t i = 0; i < SHUANG_XING_TYPE_COUNT; ++i) {
+            shuang_xing_counts[i] += other.shuang_xing_counts[i];
+        }
+        for (size_t i = 0; i < SCORE_BUCKET_COUNT; ++i) {
+            score_histogram[i] += other.score_histogram[i];
+        }
+        for (size_t s = 0; s < star_in_gong.size(); ++s) {
+            for (size_t g = 0; g < star_in_gong[s].size(); ++g) {
+                star_in_gong[s][g] += other.star_in_gong[s][g];
+            }
+        }
+    }
+
+    double GeJuStatistics::get_average_score() const {
+        return chart_count == 0 ? 0.0 : static_cast<double>(score_sum) / static_cast<double>(chart_count);
+    }
+
+    string GeJuStatistics::to_string() const {
+        string result = fmt::format("命盘数：{}（不同命盘 {}）\n平均总分：{:.2f}\n",
+            chart_count, distinct_chart_count, get_average_score());
+
+        vector<size_t> order;
+        for (size_t i = 0; i < GE_JU_TYPE_COUNT; ++i) {
+            if (ge_ju_counts[i] > 0) {
+                order.push_back(i);
+            }
+        }
+        ranges::sort(order, [this](size_t a, size_t b) { return ge_ju_counts[a] > ge_ju_counts[b]; });
+
+        result += "格局分布：\n";
+        for (size_t i : order) {
+            result += fmt::format("  {:<12} {:>10} ({:.2f}%)\n",
+                ge_ju_names[i], ge_ju_counts[i],
+                100.0 * static_cast<double>(ge_ju_counts[i]) / static_cast<double>(chart_count));
+        }
+        return result;
+    }
+
+    // ============= 统计入口 =============
+
+    GeJuStatistics collect_ge_ju_statistics(
+        const tyme::SolarDay& start,
+        const tyme::SolarDay& end,
+        const GeJuStatisticsOptions& options
+    ) {
+        const uint64_t gender_count = (options.include_male ? 1 : 0) + (options.include_female ? 1 : 0);
+        const int day_count = end.subtract(start) + 1;
+        if (gender_count == 0 || day_count <= 0) {
+            return GeJuStatistics{};
+        }
+        const unsigned threads = max(1u, options.thread_count != 0 ? options.thread_count : thread::hardware_concurrency());
+
+        // 第一阶段：历法换算，统计每个本命盘表键出现次数
+        vector<atomic<uint32_t>> key_counts(ZiWeiChartKey::COUNT);
+        parallel_for_chunks(static_cast<size_t>(day_count), DAY_CHUNK, threads,
+            [&](size_t begin, size_t end_day, unsigned) {
+                for (size_t i = begin; i < end_day; ++i) {
+                    auto day = start.next(static_cast<int>(i));
+                    for (int shi_chen = 0; shi_chen < 12; ++shi_chen) {
+                        auto input = detail::make_pai_pan_input(
+                            day.get_year(), day.get_month(), day.get_day(), shi_chen_hour(shi_chen));
+                        key_counts[input.to_chart_key().to_index()].fetch_add(1, memory_order_relaxed);
+                    }
+                }
+            });
+
+        // 第二阶段：只对出现过的键安星分析，各线程独立累加
+        vector<GeJuStatistics> partial(threads);
+        parallel_for_chunks(ZiWeiChartKey::COUNT, KEY_CHUNK, threads,
+            [&](size_t begin, size_t end_key, unsigned worker) {
+                auto& stats = partial[worker];
+                for (size_t index = begin; index < end_key; ++index) {
+                    uint32_t count = key_counts[index].load(memory_order_relaxed);
+                    if (count == 0) {
+                        continue;
+                    }
+                    auto chart = ZiWeiChart::from_key(ZiWeiChartKey::from_index(index));
+                    accumulate_chart(stats, chart, count * gender_count);
+                }
+            });
+
+        GeJuStatistics result = std::move(partial[0]);
+        for (unsigned worker = 1; worker < threads; ++worker) {
+            result.merge(partial[worker]);
+        }
+        return result;
+    }
+
+} // namespace ZhouYi::ZiWei
@@ -0,0 +1,83 @@
+// 紫微斗数格局人口统计模块（接口）
+export module ZhouYi.ZiWei.Statistics;
+
+import std;
+import ZhouYi.ZiWei.Constants;
+import ZhouYi.ZiWei.GeJu;
+import ZhouYi.ZiWei.StarMask;
+import ZhouYi.tyme;
+
+export namespace ZhouYi::ZiWei {
+    using namespace std;
+
+    constexpr size_t GE_JU_TYPE_COUNT = static_cast<size_t>(GeJuType::MinggongWuZhuXing) + 1;
+    constexpr size_t SHUANG_XING_TYPE_COUNT = static_cast<size_t>(ShuangXingType::Unknown) + 1;
+
+    /**
+     * @brief 格局统计选项
+     */
+    struct GeJuStatisticsOptions {
+        bool include_male = true;       // 统计男命
+        bool include_female = true;     // 统计女命
+        unsigned thread_count = 0;      // 工作线程数，0 表示按硬件并发数
+    };
+
+    /**
+     * @brief 格局人口统计结果（各计数均为命盘数）
+     */
+    struct GeJuStatistics {
+        // 命盘总分直方图：[SCORE_MIN, SCORE_MAX] 按 SCORE_BUCKET 分桶，越界并入两端
+        static constexpr int SCORE_MIN = -500;
+        static constexpr int SCORE_MAX = 500;
+        static constexpr int SCORE_BUCKET = 10;
+        static constexpr size_t SCORE_BUCKET_COUNT = (SCORE_MAX - SCORE_MIN) / SCORE_BUCKET + 1;
+
+        uint64_t chart_count = 0;                                       // 命盘数（含性别）
+        uint64_t distinct_chart_count = 0;                              // 实际安星分析的不同命盘数
+        array<uint64_t, GE_JU_TYPE_COUNT> ge_ju_counts{};               // 按 GeJuType 计
+        array<string, GE_JU_TYPE_COUNT> ge_ju_names{};                  // 格局名称（首次出现时记录）
+        array<uint64_t, SHUANG_XING_TYPE_COUNT> shuang_xing_counts{};   // 按 ShuangXingType 计
+        array<uint64_t, SCORE_BUCKET_COUNT> score_histogram{};          // 命盘总分分布
+        int64_t score_sum = 0;                                          // 总分之和（求均值用）
+        array<array<uint64_t, static_cast<size_t>(GongWei::COUNT)>,
+              static_cast<size_t>(StarId::COUNT)> star_in_gong{};       // [星耀][宫位] 落宫次数
+
+        /**
+         * @brief 总分所在直方图桶
+         */
+        static size_t score_bucket(int score);
+
+        /**
+         * @brief 合并另一份统计（各工作线程结果归并用）
+         */
+        void merge(const GeJuStatistics& other);
+
+        /**
+         * @brief 平均命盘总分
+         */
+        double get_average_score() const;
+
+        /**
+         * @brief 格式化输出（按出现次数排列格局）
+         */
+        string to_string() const;
+    };
+
+    /**
+     * @brief 统计出生日期范围内全部命盘的格局分布
+     *
+     * 范围内每日取十二时辰各一盘。先并行求出每盘的本命盘表键并计数，
+     * 再只对出现过的不同键并行安星、分析格局与双星组合，按出现次数加权。
+     * 安星与格局均不依赖性别，男女两命共用一次分析。
+     * 工作线程从共享计数器领取小块任务（动态负载均衡），各自累加后在结束时归并。
+     *
+     * @param start 起始阳历日
+     * @param end 结束阳历日（含）
+     */
+    GeJuStatistics collect_ge_ju_statistics(
+        const tyme::SolarDay& start,
+        const tyme::SolarDay& end,
+        const GeJuStatisticsOptions& options = {}
+    );
+
+} // namespace ZhouYi::ZiWei
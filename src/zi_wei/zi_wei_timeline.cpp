@@ -0,0 +1,227 @@
+// 紫微斗数运限时间线模块（实现）
+module ZhouYi.ZiWei.Timeline;
+
+import ZhouYi.GanZhi;
+import ZhouYi.ZiWei.Constants;
+import ZhouYi.ZiWei.Horoscope;
+import ZhouYi.ZiWei.Star;
+import ZhouYi.ZiWei;
+import ZhouYi.tyme;
+import std;
+
+namespace ZhouYi::ZiWei {
+    using namespace std;
+    using namespace ZhouYi::GanZhi;
+
+    namespace {
+        constexpr HoroscopeLayerKey NO_LAYER = {.tian_gan = 0, .di_zhi = 0, .gong_index = -1};
+
+        constexpr HoroscopeLayerKey make_key(int cycle, int gong_index) {
+            return HoroscopeLayerKey{
+                .tian_gan = static_cast<uint8_t>(cycle % 10),
+                .di_zhi = static_cast<uint8_t>(cycle % 12),
+                .gong_index = static_cast<int8_t>(gong_index)
+            };
+        }
+
+        constexpr uint8_t ALL_LAYERS = (1u << TIMELINE_LAYER_COUNT) - 1;
+    }
+
+    HoroscopeTimeline::HoroscopeTimeline(
+        const ZiWeiResult& natal,
+        const tyme::SolarDay& start,
+        const tyme::SolarDay& end,
+        Scope step
+    ) : ming_gong_index_(natal.ming_gong_index),
+        is_male_(natal.is_male),
+        birth_year_zhi_(natal.year_pillar.zhi),
+        birth_lunar_year_(natal.lunar_day.get_year()),
+        birth_lunar_month_(natal.lunar_day.get_lunar_month().get_month()),
+        da_xian_(arrange_da_xian(natal.ming_gong_index, natal.wu_xing_ju, natal.is_male, natal.year_pillar.zhi)),
+        day_(start),
+        remaining_days_(max(0, end.subtract(start) + 1)),
+        hourly_(step == Scope::Hourly) {
+        if (step != Scope::Daily && step != Scope::Hourly) {
+            throw invalid_argument("时间线步长只支持逐日或逐时辰");
+        }
+    }
+
+    void HoroscopeTimeline::sync_lunar() {
+        auto lunar_day = day_.get_lunar_day();
+        auto lunar_month = lunar_day.get_lunar_month();
+        lunar_year_ = lunar_day.get_year();
+        lunar_month_ = lunar_day.get_month();
+        lunar_day_ = lunar_day.get_day();
+        lunar_month_days_ = lunar_month.get_day_count();
+    }
+
+    void HoroscopeTimeline::sync_cycle() {
+        auto sixty_cycle_day = day_.get_sixty_cycle_day();
+        year_cycle_ = sixty_cycle_day.get_year().get_index();
+        month_cycle_ = sixty_cycle_day.get_month().get_index();
+        day_cycle_ = sixty_cycle_day.get_sixty_cycle().get_index();
+
+        // 月柱（及立春时的年柱）只在交节日更替，找出下一个节
+        auto term = day_.get_term();
+        do {
+            term = term.next(1);
+        } while (!term.is_jie());
+        days_to_jie_ = max(1, term.get_julian_day().get_solar_day().subtract(day_));
+    }
+
+    HoroscopeLayer& HoroscopeTimeline::layer_ref(TimelineLayer layer) {
+        return layers_[countr_zero(static_cast<unsigned>(layer))];
+    }
+
+    const HoroscopeLayer& HoroscopeTimeline::get_layer(TimelineLayer layer) const {
+        return layers_[countr_zero(static_cast<unsigned>(layer))];
+    }
+
+    uint8_t HoroscopeTimeline::update_layer(TimelineLayer layer, const HoroscopeLayerKey& key) {
+        auto& current = layer_ref(layer);
+        if (started_ && current.key == key) {
+            return 0;
+        }
+
+        current.key = key;
+        current.si_hua_xing.fill(-1);
+        current.liu_yao_gong.fill(-1);
+        // 小限只有宫位，无干支四化流耀
+        if (key.is_valid() && layer != TimelineLayer::XiaoXian) {
+            auto si_hua_xing = get_si_hua_xing(key.get_tian_gan());
+            for (int i = 0; i < 4; ++i) {
+                current.si_hua_xing[i] = static_cast<int8_t>(si_hua_xing[i]);
+            }
+            auto liu_yao = get_liu_yao_index(key.get_tian_gan(), key.get_di_zhi());
+            for (int i = 0; i < LIU_YAO_COUNT; ++i) {
+                current.liu_yao_gong[i] = static_cast<int8_t>(liu_yao[i]);
+            }
+        }
+        return static_cast<uint8_t>(layer);
+    }
+
+    uint8_t HoroscopeTimeline::enter_day() {
+        if (!started_) {
+            sync_lunar();
+            sync_cycle();
+        } else {
+            day_ = day_.next(1);
+            // 农历日递推，越过月末时重新同步（闰月、大小月由 tyme 决定）
+            if (++lunar_day_ > lunar_month_days_) {
+                sync_lunar();
+            }
+            // 日干支逐日加一，交节日重新同步年、月柱
+            day_cycle_ = (day_cycle_ + 1) % 60;
+            if (--days_to_jie_ <= 0) {
+                sync_cycle();
+            }
+        }
+
+        uint8_t changed = 0;
+
+        // 大限、小限随虚岁（农历年）变化
+        age_ = lunar_year_ - birth_lunar_year_ + 1;
+        HoroscopeLayerKey da_xian = NO_LAYER;
+        for (const auto& data : da_xian_) {
+            if (age_ >= data.start_age && age_ <= data.end_age) {
+                da_xian = HoroscopeLayerKey{
+                    .tian_gan = static_cast<uint8_t>(data.tian_gan),
+                    .di_zhi = static_cast<uint8_t>(data.di_zhi),
+                    .gong_index = static_cast<int8_t>(data.gong_index)
+                };
+                break;
+            }
+        }
+        changed |= update_layer(TimelineLayer::DaXian, da_xian);
+
+        HoroscopeLayerKey xiao_xian = NO_LAYER;
+        if (age_ >= 1) {
+            xiao_xian.gong_index = static_cast<int8_t>(get_xiao_xian(age_, is_male_, birth_year_zhi_).gong_index);
+        }
+        changed |= update_layer(TimelineLayer::XiaoXian, xiao_xian);
+
+        // 流年、流月、流日
+        auto year_zhi = static_cast<DiZhi>(year_cycle_ % 12);
+        changed |= update_layer(TimelineLayer::LiuNian, make_key(year_cycle_, get_liu_nian_index(year_zhi)));
+
+        int liu_yue_index = get_liu_yue_index(abs(lunar_month_), birth_lunar_month_, year_zhi);
+        changed |= update_layer(TimelineLayer::LiuYue, make_key(month_cycle_, liu_yue_index));
+        changed |= update_layer(TimelineLayer::LiuRi, make_key(day_cycle_, get_liu_ri_index(lunar_day_, liu_yue_index)));
+
+        if (!hourly_) {
+            changed |= update_layer(TimelineLayer::LiuShi, NO_LAYER);
+        }
+
+        return changed;
+    }
+
+    bool HoroscopeTimeline::next(HoroscopeTimelineStep& step) {
+        if (remaining_days_ <= 0) {
+            return false;
+        }
+
+        uint8_t changed = 0;
+        if (hour_ == 0) {
+            changed = enter_day();
+        }
+        if (hourly_) {
+            // 五鼠遁：由日干起时干
+            int hour_gan = (day_cycle_ % 10 % 5 * 2 + hour_) % 10;
+            auto hour_zhi = static_cast<DiZhi>(hour_);
+            int liu_ri_index = get_layer(TimelineLayer::LiuRi).key.gong_index;
+            changed |= update_layer(TimelineLayer::LiuShi, HoroscopeLayerKey{
+                .tian_gan = static_cast<uint8_t>(hour_gan),
+                .di_zhi = static_cast<uint8_t>(hour_),
+                .gong_index = static_cast<int8_t>(get_liu_shi_index(hour_zhi, liu_ri_index))
+            });
+        }
+        if (!started_) {
+            changed = ALL_LAYERS;
+            started_ = true;
+        }
+
+        step = HoroscopeTimelineStep{
+            .solar_year = static_cast<int16_t>(day_.get_year()),
+            .solar_month = static_cast<uint8_t>(day_.get_month()),
+            .solar_day = static_cast<uint8_t>(day_.get_day()),
+            .lunar_month = static_cast<int8_t>(lunar_month_),
+            .lunar_day = static_cast<uint8_t>(lunar_day_),
+            .hour_zhi = static_cast<uint8_t>(hour_),
+            .changed = changed,
+            .age = static_cast<int16_t>(age_),
+            .xiao_xian_gong = get_layer(TimelineLayer::XiaoXian).key.gong_index,
+            .da_xian = get_layer(TimelineLayer::DaXian).key,
+            .liu_nian = get_layer(TimelineLayer::LiuNian).key,
+            .liu_yue = get_layer(TimelineLayer::LiuYue).key,
+            .liu_ri = get_layer(TimelineLayer::LiuRi).key,
+            .liu_shi = get_layer(TimelineLayer::LiuShi).key
+        };
+
+        if (hourly_ && ++hour_ < 12) {
+            return true;
+        }
+        hour_ = 0;
+        --remaining_days_;
+        return true;
+    }
+
+    vector<HoroscopeTimelineStep> HoroscopeTimeline::collect() {
+        vector<HoroscopeTimelineStep> result;
+        result.reserve(static_cast<size_t>(remaining_days_) * (hourly_ ? 12 : 1));
+        HoroscopeTimelineStep step{};
+        while (next(step)) {
+            result.push_back(step);
+        }
+        return result;
+    }
+
+    vector<HoroscopeTimelineStep> generate_horoscope_timeline(
+        const ZiWeiResult& natal,
+        const tyme::SolarDay& start,
+        const tyme::SolarDay& end,
+        Scope step
+    ) {
+        return HoroscopeTimeline(natal, start, end, step).collect();
+    }
+
+} // namespace ZhouYi::ZiWei
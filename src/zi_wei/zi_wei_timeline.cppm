@@ -0,0 +1,172 @@
+// 紫微斗数运限时间线模块（接口）
+export module ZhouYi.ZiWei.Timeline;
+
+import std;
+import ZhouYi.GanZhi;
+import ZhouYi.ZiWei.Constants;
+import ZhouYi.ZiWei.Horoscope;
+import ZhouYi.ZiWei;
+import ZhouYi.tyme;
+
+export namespace ZhouYi::ZiWei {
+    using namespace std;
+    using namespace ZhouYi::GanZhi;
+
+    /**
+     * @brief 时间线中的运限层（位标志）
+     */
+    enum class TimelineLayer : uint8_t {
+        DaXian = 1 << 0,    // 大限
+        XiaoXian = 1 << 1,  // 小限
+        LiuNian = 1 << 2,   // 流年
+        LiuYue = 1 << 3,    // 流月
+        LiuRi = 1 << 4,     // 流日
+        LiuShi = 1 << 5     // 流时
+    };
+
+    constexpr int TIMELINE_LAYER_COUNT = 6;
+
+    /**
+     * @brief 单层运限的紧凑键（干支与所在宫位）
+     */
+    struct HoroscopeLayerKey {
+        uint8_t tian_gan;
+        uint8_t di_zhi;
+        int8_t gong_index;      // -1 表示该层未起（如未到起运年龄、按日步进时的流时）
+
+        TianGan get_tian_gan() const {
+            return static_cast<TianGan>(tian_gan);
+        }
+
+        DiZhi get_di_zhi() const {
+            return static_cast<DiZhi>(di_zhi);
+        }
+
+        bool is_valid() const {
+            return gong_index >= 0;
+        }
+
+        bool operator==(const HoroscopeLayerKey&) const = default;
+    };
+
+    /**
+     * @brief 单层运限详情（四化与流耀，仅在该层变化时重算）
+     */
+    struct HoroscopeLayer {
+        HoroscopeLayerKey key;
+        array<int8_t, 4> si_hua_xing;               // 禄权科忌所化主星（ZhuXing 数值，-1 表示无）
+        array<int8_t, LIU_YAO_COUNT> liu_yao_gong;  // 魁钺昌曲禄羊陀马鸾喜所在宫（-1 表示无）
+    };
+
+    /**
+     * @brief 时间线单步记录（可平凡复制，不含字符串）
+     */
+    struct HoroscopeTimelineStep {
+        int16_t solar_year;
+        uint8_t solar_month;
+        uint8_t solar_day;
+        int8_t lunar_month;         // 闰月为负
+        uint8_t lunar_day;
+        uint8_t hour_zhi;           // 按日步进时为子时
+        uint8_t changed;            // 本步变化的运限层（TimelineLayer 位掩码）
+        int16_t age;                // 虚岁
+        int8_t xiao_xian_gong;      // 小限宫位
+        HoroscopeLayerKey da_xian;
+        HoroscopeLayerKey liu_nian;
+        HoroscopeLayerKey liu_yue;
+        HoroscopeLayerKey liu_ri;
+        HoroscopeLayerKey liu_shi;
+
+        bool has_changed(TimelineLayer layer) const {
+            return (changed & static_cast<uint8_t>(layer)) != 0;
+        }
+    };
+
+    static_assert(is_trivially_copyable_v<HoroscopeTimelineStep>);
+
+    /**
+     * @brief 运限时间线生成器
+     *
+     * 自起始日逐日（或逐时辰）前行至结束日（含）。历法只在农历月末与交节日重新查询，
+     * 其余日子按日干支与农历日递推；每步只重算干支或宫位发生变化的运限层。
+     *
+     * 流月以农历生月起算，流年、流月干支按节令划分，与 get_liu_nian/get_liu_yue 一致。
+     */
+    class HoroscopeTimeline {
+    public:
+        /**
+         * @param natal 本命盘
+         * @param start 起始阳历日
+         * @param end 结束阳历日（含）
+         * @param step 步长，Scope::Daily 或 Scope::Hourly（其余抛出 invalid_argument）
+         */
+        HoroscopeTimeline(
+            const ZiWeiResult& natal,
+            const tyme::SolarDay& start,
+            const tyme::SolarDay& end,
+            Scope step = Scope::Daily
+        );
+
+        /**
+         * @brief 前进一步
+         * @return 已越过结束日时返回 false
+         */
+        bool next(HoroscopeTimelineStep& step);
+
+        /**
+         * @brief 当前一步的某层运限详情
+         */
+        const HoroscopeLayer& get_layer(TimelineLayer layer) const;
+
+        /**
+         * @brief 取出剩余全部步
+         */
+        vector<HoroscopeTimelineStep> collect();
+
+    private:
+        // 本命信息
+        int ming_gong_index_;
+        bool is_male_;
+        DiZhi birth_year_zhi_;
+        int birth_lunar_year_;
+        int birth_lunar_month_;
+        array<DaXianData, 12> da_xian_;
+
+        // 步进状态
+        tyme::SolarDay day_;
+        int remaining_days_;
+        bool hourly_;
+        bool started_ = false;
+        int hour_ = 0;
+
+        // 历法递推状态（仅在边界处向 tyme 重新同步）
+        int lunar_year_ = 0;
+        int lunar_month_ = 0;
+        int lunar_day_ = 0;
+        int lunar_month_days_ = 0;
+        int year_cycle_ = 0;
+        int month_cycle_ = 0;
+        int day_cycle_ = 0;
+        int days_to_jie_ = 0;
+
+        int age_ = 0;
+        array<HoroscopeLayer, TIMELINE_LAYER_COUNT> layers_{};
+
+        void sync_lunar();
+        void sync_cycle();
+        uint8_t enter_day();
+        uint8_t update_layer(TimelineLayer layer, const HoroscopeLayerKey& key);
+        HoroscopeLayer& layer_ref(TimelineLayer layer);
+    };
+
+    /**
+     * @brief 生成运限时间线（逐日或逐时辰）
+     */
+    vector<HoroscopeTimelineStep> generate_horoscope_timeline(
+        const ZiWeiResult& natal,
+        const tyme::SolarDay& start,
+        const tyme::SolarDay& end,
+        Scope step = Scope::Daily
+    );
+
+} // namespace ZhouYi::ZiWei
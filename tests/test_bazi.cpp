@@ -1,7 +1,10 @@
 // 八字系统测试
 
 import ZhouYi.BaZiBase;
+import ZhouYi.BaZiBase.Kernel;
+import ZhouYi.BaZiController;
 import ZhouYi.GanZhi;
+import ZhouYi.tyme;
 import nlohmann.json;  // 添加 JSON 支持
 import std;
 
@@ -89,17 +92,41 @@ TEST_SUITE("八字系统测试") {
         }
     }
     
+    TEST_CASE("六十甲子序号换算") {
+        SUBCASE("与名称换算一致") {
+            for (int i = 0; i < 60; ++i) {
+                auto cycle = tyme::SixtyCycle::from_index(i);
+                Pillar by_index = Pillar::from_sixty_cycle(cycle);
+                Pillar by_name(cycle.get_heaven_stem().get_name(), cycle.get_earth_branch().get_name());
+                CHECK(by_index == by_name);
+                CHECK(by_index.to_sixty_cycle_index() == i);
+            }
+        }
+        
+        SUBCASE("BaZi 为定长平凡类型") {
+            CHECK(std::is_trivially_copyable_v<BaZi>);
+            CHECK(sizeof(BaZi) == 10);
+        }
+    }
+    
     TEST_CASE("旬空计算") {
         SUBCASE("验证旬空规则") {
             auto bazi = BaZi::from_solar(2024, 10, 13, 14, 30);
             
-            // 旬空应该是两个地支
-            CHECK_FALSE(bazi.xun_kong_1.empty());
-            CHECK_FALSE(bazi.xun_kong_2.empty());
-            
             // 旬空地支不应该相同
             CHECK(bazi.xun_kong_1 != bazi.xun_kong_2);
         }
+        
+        SUBCASE("与 tyme 旬空一致") {
+            for (int i = 0; i < 60; ++i) {
+                auto cycle = tyme::SixtyCycle::from_index(i);
+                auto xun_kong = Pillar::from_sixty_cycle(cycle).get_xun_kong();
+                auto branches = cycle.get_extra_earth_branches();
+                REQUIRE(branches.size() == 2);
+                CHECK(Mapper::to_zh(xun_kong[0]) == branches[0].get_name());
+                CHECK(Mapper::to_zh(xun_kong[1]) == branches[1].get_name());
+            }
+        }
     }
     
     TEST_CASE("日期转换") {
@@ -162,9 +189,195 @@ TEST_SUITE("八字系统测试") {
             CHECK(bazi.month.to_string() == "乙丑");
             CHECK(bazi.day.to_string() == "丙寅");
             CHECK(bazi.hour.to_string() == "丁卯");
-            CHECK(bazi.xun_kong_1 == "戌");
-            CHECK(bazi.xun_kong_2 == "亥");
+            CHECK(bazi.xun_kong_1 == DiZhi::Xu);
+            CHECK(bazi.xun_kong_2 == DiZhi::Hai);
+        }
+    }
+    
+    TEST_CASE("流运区间") {
+        auto result = ZhouYi::BaZiController::pai_pan_solar(1990, 5, 20, 8, 30, true,
+                                                            ZhouYi::BaZiController::PaiPanPart::SiZhu);
+        
+        SUBCASE("流年与 tyme 干支年一致") {
+            std::vector<ZhouYi::BaZiController::LiuNian> list;
+            result.liu_nian_range(1900, 201, list);
+            REQUIRE(list.size() == 201);
+            for (const auto& liu_nian : list) {
+                auto cycle = tyme::SixtyCycleYear::from_year(liu_nian.year).get_sixty_cycle();
+                CHECK(liu_nian.pillar == Pillar::from_sixty_cycle(cycle));
+                CHECK(liu_nian.age == liu_nian.year - 1990 + 1);
+            }
+            CHECK(result.get_liu_nian(2024).pillar.to_string() == "甲辰");
+        }
+        
+        SUBCASE("流月与月中八字月柱一致") {
+            std::vector<ZhouYi::BaZiController::LiuYue> list;
+            for (int year = 1900; year <= 2100; ++year) {
+                result.liu_yue_range(year, list);
+                REQUIRE(list.size() == 12);
+                for (const auto& liu_yue : list) {
+                    auto eight_char = tyme::SolarTime::from_ymd_hms(year, liu_yue.month, 15, 12, 0, 0)
+                        .get_lunar_hour().get_eight_char();
+                    CHECK(liu_yue.pillar == Pillar::from_sixty_cycle(eight_char.get_month()));
+                }
+            }
+        }
+        
+        SUBCASE("流日与逐日排盘一致") {
+            std::vector<ZhouYi::BaZiController::LiuRi> list;
+            result.liu_ri_range(SolarDate{2023, 12, 1}, 800, list);
+            REQUIRE(list.size() == 800);
+            auto day = tyme::SolarDay::from_ymd(2023, 12, 1);
+            for (const auto& liu_ri : list) {
+                CHECK(liu_ri.year == day.get_year());
+                CHECK(liu_ri.month == day.get_month());
+                CHECK(liu_ri.day == day.get_day());
+                CHECK(liu_ri.pillar == result.get_liu_ri(liu_ri.year, liu_ri.month, liu_ri.day).pillar);
+                day = day.next(1);
+            }
+            
+            // 复用缓冲区
+            result.liu_ri_range(SolarDate{1582, 10, 3}, 3, list);
+            REQUIRE(list.size() == 3);
+            CHECK(list[2].day == 15);
+        }
+    }
+    
+    TEST_CASE("大运延迟计算") {
+        using ZhouYi::BaZiController::PaiPanPart;
+        
+        auto full = ZhouYi::BaZiController::pai_pan_solar(1990, 5, 20, 8, 30, true);
+        auto lazy = ZhouYi::BaZiController::pai_pan_solar(1990, 5, 20, 8, 30, true, PaiPanPart::SiZhu);
+        CHECK(full.has_da_yun_system());
+        CHECK_FALSE(lazy.has_da_yun_system());
+        CHECK(lazy.ba_zi == full.ba_zi);
+        CHECK(lazy.get_si_zhu_shi_shen() == full.get_si_zhu_shi_shen());
+        
+        // 副本共享延迟状态
+        auto copy = lazy;
+        CHECK(lazy.get_da_yun_system().get_qi_yun_age() == full.get_da_yun_system().get_qi_yun_age());
+        CHECK(copy.has_da_yun_system());
+        
+        const auto& a = lazy.get_da_yun_system().get_da_yun_list();
+        const auto& b = full.get_da_yun_system().get_da_yun_list();
+        REQUIRE(a.size() == b.size());
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            CHECK(a[i].pillar == b[i].pillar);
+            CHECK(a[i].start_age == b[i].start_age);
+        }
+    }
+    
+    TEST_CASE("批量排盘") {
+        using ZhouYi::BaZiController::BatchRequest;
+        using ZhouYi::BaZiController::BatchOptions;
+        
+        // 含相同时刻、不同性别与立春前后的请求
+        std::vector<BatchRequest> requests;
+        for (int i = 0; i < 40; ++i) {
+            requests.push_back({2024, 2, 3 + i / 20, i % 10 * 2, 0, i % 3 == 0});
+        }
+        
+        auto expected = ZhouYi::BaZiController::batch_pai_pan(requests);
+        REQUIRE(expected.size() == requests.size());
+        for (std::size_t i = 0; i < requests.size(); ++i) {
+            const auto& r = requests[i];
+            auto single = ZhouYi::BaZiController::pai_pan_solar(r.year, r.month, r.day, r.hour, r.minute, r.is_male);
+            CHECK(expected[i].ba_zi == single.ba_zi);
+            CHECK(expected[i].get_da_yun_system().get_qi_yun_age() == single.get_da_yun_system().get_qi_yun_age());
+        }
+        
+        SUBCASE("多线程结果与单线程一致") {
+            for (bool deterministic : {false, true}) {
+                auto results = ZhouYi::BaZiController::batch_pai_pan(
+                    requests, BatchOptions{.thread_count = 4, .chunk_size = 3, .deterministic = deterministic});
+                REQUIRE(results.size() == expected.size());
+                for (std::size_t i = 0; i < results.size(); ++i) {
+                    CHECK(results[i].ba_zi == expected[i].ba_zi);
+                    CHECK(results[i].is_male == expected[i].is_male);
+                }
+            }
+        }
+        
+        SUBCASE("只排四柱") {
+            auto results = ZhouYi::BaZiController::batch_pai_pan(
+                requests, BatchOptions{.thread_count = 2, .parts = ZhouYi::BaZiController::PaiPanPart::SiZhu});
+            for (std::size_t i = 0; i < results.size(); ++i) {
+                CHECK(results[i].ba_zi == expected[i].ba_zi);
+                CHECK_FALSE(results[i].has_da_yun_system());
+            }
+        }
+        
+        SUBCASE("输出区长度不符") {
+            std::vector<std::optional<ZhouYi::BaZiController::BaZiResult>> slots(1);
+            CHECK_THROWS_AS(ZhouYi::BaZiController::batch_pai_pan(requests, slots), std::invalid_argument);
+        }
+    }
+    
+    TEST_CASE("四柱批量内核") {
+        auto table = JieQiTable::build(1900, 2100);
+        
+        auto to_seconds = [](const tyme::SolarTime& t) {
+            return to_civil_seconds(t.get_year(), t.get_month(), t.get_day(),
+                                    t.get_hour(), t.get_minute(), t.get_second());
+        };
+        auto from_solar = [](const tyme::SolarTime& t) {
+            return BaZi::from_solar(t.get_year(), t.get_month(), t.get_day(),
+                                    t.get_hour(), t.get_minute(), t.get_second());
+        };
+        
+        // 每年若干随机时刻（含 23 时），以及每个节的前一秒与节的时刻
+        std::vector<tyme::SolarTime> times;
+        std::uint32_t seed = 20241013;
+        auto next_random = [&seed](int n) {
+            seed = seed * 1664525u + 1013904223u;
+            return static_cast<int>(seed >> 8) % n;
+        };
+        for (int year = 1900; year <= 2100; ++year) {
+            for (int i = 0; i < 12; ++i) {
+                times.push_back(tyme::SolarTime::from_ymd_hms(
+                    year, i + 1, 1 + next_random(28), i % 4 == 0 ? 23 : next_random(24),
+                    next_random(60), next_random(60)));
+            }
+            for (int index = 1; index <= 23; index += 2) {
+                auto jie = tyme::SolarTerm::from_index(year, index).get_julian_day().get_solar_time();
+                times.push_back(jie.next(-1));
+                times.push_back(jie);
+            }
+        }
+        
+        std::vector<std::int64_t> seconds;
+        for (const auto& t : times) {
+            seconds.push_back(to_seconds(t));
+        }
+        
+        SUBCASE("与 BaZi::from_solar 一致") {
+            std::vector<SiZhuIndex> out(seconds.size());
+            compute_si_zhu(seconds, table, out);
+            for (std::size_t i = 0; i < times.size(); ++i) {
+                INFO(times[i].to_string());
+                CHECK(out[i].to_ba_zi() == from_solar(times[i]));
+            }
+        }
+        
+        SUBCASE("乱序输入") {
+            auto shuffled = seconds;
+            std::ranges::shuffle(shuffled, std::mt19937(7));
+            std::vector<SiZhuIndex> out(shuffled.size());
+            compute_si_zhu(shuffled, table, out);
+            for (std::size_t i = 0; i < shuffled.size(); ++i) {
+                CHECK(out[i] == compute_si_zhu(shuffled[i], table));
+            }
+        }
+        
+        SUBCASE("超出节气表范围") {
+            CHECK(table.contains(to_civil_seconds(1900, 1, 1)));
+            CHECK_FALSE(table.contains(to_civil_seconds(2101, 1, 1)));
+            CHECK_THROWS_AS(compute_si_zhu(to_civil_seconds(1899, 12, 31, 23, 59, 59), table), std::out_of_range);
+            CHECK_THROWS_AS(table.get_month_ordinal(to_civil_seconds(2101, 1, 1)), std::out_of_range);
+            CHECK_THROWS_AS(JieQiTable::build(2000, 1999), std::invalid_argument);
+            
+            std::vector<SiZhuIndex> out(1);
+            CHECK_THROWS_AS(compute_si_zhu(seconds, table, out), std::invalid_argument);
         }
     }
 }
-
@@ -0,0 +1,231 @@
+// Tyme 历法测试
+
+import ZhouYi.tyme;
+import std;
+
+#include <doctest/doctest.h>
+
+using namespace tyme;
+
+TEST_SUITE("Tyme 历法测试") {
+
+    TEST_CASE("农历月表") {
+        SUBCASE("查表与寿星天文历一致") {
+            for (int year: {1900, 1984, 2023, 2025, 2033, 2100}) {
+                const int leap_month = LunarYear::from_year(year).get_leap_month();
+                CHECK(LunarTable::get_leap_month(year) == leap_month);
+                for (int month = 1; month <= 12; month++) {
+                    const LunarMonth a = LunarMonth::from_ym(year, month);
+                    const LunarMonth b = LunarMonth(year, month, false);
+                    CHECK(a.get_first_julian_day().get_day() == b.get_first_julian_day().get_day());
+                    CHECK(a.get_day_count() == b.get_day_count());
+                    CHECK(a.get_index_in_year() == b.get_index_in_year());
+                }
+                if (leap_month > 0) {
+                    const LunarMonth a = LunarMonth::from_ym(year, -leap_month);
+                    const LunarMonth b = LunarMonth(year, -leap_month, false);
+                    CHECK(a.get_first_julian_day().get_day() == b.get_first_julian_day().get_day());
+                    CHECK(a.get_day_count() == b.get_day_count());
+                }
+            }
+        }
+
+        SUBCASE("表范围外使用寿星天文历") {
+            CHECK_FALSE(LunarTable::contains(LunarTable::MIN_YEAR - 1));
+            CHECK_FALSE(LunarTable::contains(LunarTable::MAX_YEAR + 1));
+            const LunarMonth m = LunarMonth::from_ym(1899, 1);
+            CHECK(m.next(1).get_year() == 1899);
+        }
+
+        SUBCASE("公历转农历") {
+            const LunarDay d = SolarDay::from_ymd(2025, 1, 29).get_lunar_day();
+            CHECK(d.get_year() == 2025);
+            CHECK(d.get_month() == 1);
+            CHECK(d.get_day() == 1);
+
+            const LunarDay leap = SolarDay::from_ymd(2023, 3, 22).get_lunar_day();
+            CHECK(leap.get_lunar_month().is_leap());
+            CHECK(leap.get_lunar_month().get_month() == 2);
+            CHECK(leap.get_day() == 1);
+        }
+
+        SUBCASE("闰月表") {
+            CHECK(LunarYear::from_year(-1).get_leap_month() == 11);
+            CHECK(LunarYear::from_year(2020).get_leap_month() == 4);
+            CHECK(LunarYear::from_year(2023).get_leap_month() == 2);
+            CHECK(LunarYear::from_year(2024).get_leap_month() == 0);
+            CHECK(LunarYear::from_year(2025).get_leap_month() == 6);
+            CHECK(LunarYear::from_year(2025).get_month_count() == 13);
+        }
+
+        SUBCASE("非法闰月") {
+            CHECK_THROWS_AS(LunarMonth::from_ym(2024, -5), std::invalid_argument);
+        }
+    }
+
+    TEST_CASE("节气缓存") {
+        SUBCASE("重复查询命中缓存") {
+            const double jd = SolarTerm::from_index(2024, 3).get_julian_day().get_day();
+            const std::uint64_t hits = SolarTermCache::get_hits();
+            CHECK(SolarTerm::from_index(2024, 3).get_julian_day().get_day() == jd);
+            CHECK(SolarTermCache::get_hits() >= hits + 2);
+        }
+
+        SUBCASE("范围外直接计算") {
+            const std::uint64_t misses = SolarTermCache::get_misses();
+            const SolarTerm term = SolarTerm::from_index(SolarTermCache::MIN_YEAR - 1, 0);
+            CHECK(term.get_name() == "冬至");
+            CHECK(SolarTermCache::get_misses() > misses);
+        }
+    }
+
+    TEST_CASE("节假日") {
+        SUBCASE("法定假日查询") {
+            const auto h = LegalHoliday::from_ymd(2025, 10, 1);
+            REQUIRE(h.has_value());
+            CHECK(h->get_name() == "国庆中秋");
+            CHECK_FALSE(h->is_work());
+            CHECK_FALSE(LegalHoliday::from_ymd(2025, 10, 20).has_value());
+        }
+
+        SUBCASE("法定假日推移") {
+            const auto h = LegalHoliday::from_ymd(2025, 10, 1);
+            REQUIRE(h.has_value());
+            const auto prev = h->next(-1);
+            REQUIRE(prev.has_value());
+            CHECK(prev->get_day().get_day() == 28);
+            CHECK(prev->is_work());
+            CHECK(prev->get_target().get_day() == 1);
+
+            const auto last = LegalHoliday::from_ymd(2024, 12, 31);
+            CHECK_FALSE(last.has_value());
+            const auto cross = LegalHoliday::from_ymd(2024, 10, 12);
+            REQUIRE(cross.has_value());
+            const auto next_year = cross->next(1);
+            REQUIRE(next_year.has_value());
+            CHECK(next_year->get_day().get_year() == 2025);
+        }
+
+        SUBCASE("公历和农历节日") {
+            const auto solar = SolarFestival::from_ymd(2025, 10, 1);
+            REQUIRE(solar.has_value());
+            CHECK(solar->get_name() == "国庆节");
+            CHECK_FALSE(SolarFestival::from_ymd(1900, 10, 1).has_value());
+            CHECK(SolarFestival::from_index(2025, 0)->get_day().get_month() == 1);
+
+            const auto lunar = LunarFestival::from_ymd(2025, 8, 15);
+            REQUIRE(lunar.has_value());
+            CHECK(lunar->get_name() == "中秋节");
+            const auto qing_ming = LunarFestival::from_index(2025, 4);
+            REQUIRE(qing_ming.has_value());
+            CHECK(qing_ming->get_solar_term().has_value());
+        }
+    }
+
+    TEST_CASE("批量历法转换") {
+        SUBCASE("与逐日转换一致") {
+            // 覆盖闰二月(2023)、立春前后、跨公历年
+            const SolarDay start = SolarDay::from_ymd(2022, 12, 1);
+            const CalendarColumns c = CalendarBatch::convert(start.get_julian_day(), SolarDay::from_ymd(2025, 3, 1).get_julian_day());
+            REQUIRE(c.size() == static_cast<size_t>(SolarDay::from_ymd(2025, 3, 1).subtract(start)));
+            for (size_t i = 0; i < c.size(); i++) {
+                const SolarDay d = start.next(static_cast<int>(i));
+                const LunarDay lunar_day = d.get_lunar_day();
+                const LunarMonth m = lunar_day.get_lunar_month();
+                const SixtyCycleDay s = d.get_sixty_cycle_day();
+                CHECK(c.lunar_year[i] == m.get_year());
+                CHECK(c.lunar_month[i] == m.get_month());
+                CHECK(c.lunar_day[i] == lunar_day.get_day());
+                CHECK((c.lunar_leap[i] == 1) == m.is_leap());
+                CHECK(c.year_sixty_cycle[i] == s.get_year().get_index());
+                CHECK(c.month_sixty_cycle[i] == s.get_month().get_index());
+                CHECK(c.day_sixty_cycle[i] == s.get_sixty_cycle().get_index());
+                CHECK(c.term[i] == d.get_term().get_index());
+            }
+        }
+
+        SUBCASE("追加与空范围") {
+            CalendarColumns c;
+            CalendarBatch::convert(SolarDay::from_ymd(2024, 1, 1), 10, c);
+            CalendarBatch::convert(SolarDay::from_ymd(2024, 1, 11), 0, c);
+            CHECK(c.size() == 10);
+            c.clear();
+            CHECK(c.size() == 0);
+        }
+    }
+
+    TEST_CASE("紧凑值类型") {
+        SUBCASE("与对象互转") {
+            const SolarTime t = SolarTime::from_ymd_hms(2024, 2, 10, 13, 45, 30);
+            const SolarTimeValue v = to_value(t);
+            CHECK(to_solar_time(v).equals(t));
+            CHECK(to_value(t.get_solar_day()).day == v.day);
+            CHECK(to_julian_day(v).get_day() == doctest::Approx(t.get_julian_day().get_day()));
+
+            const LunarHour h = LunarHour::from_ymd_hms(2023, -2, 15, 8, 0, 0);
+            CHECK(to_lunar_hour(to_value(h)).get_lunar_day().equals(h.get_lunar_day()));
+        }
+
+        SUBCASE("公历农历互转") {
+            // 跨越查表范围两端和闰月
+            for (const SolarDay &start: {SolarDay::from_ymd(1899, 12, 1), SolarDay::from_ymd(2023, 1, 1), SolarDay::from_ymd(2100, 12, 1)}) {
+                for (int i = 0; i < 500; i++) {
+                    const SolarDay d = start.next(i);
+                    const LunarDayValue l = to_lunar_day_value(to_value(d));
+                    CHECK(l == to_value(d.get_lunar_day()));
+                    CHECK(to_solar_day_value(l) == to_value(d));
+                }
+            }
+        }
+
+        SUBCASE("非法农历日") {
+            CHECK_THROWS_AS(to_solar_day_value(LunarDayValue{2024, -3, 1}), std::invalid_argument);
+            CHECK_THROWS_AS(to_solar_day_value(LunarDayValue{2024, 1, 31}), std::invalid_argument);
+        }
+    }
+
+    TEST_CASE("八字反推公历时刻") {
+        SUBCASE("串行") {
+            const std::vector<SolarTime> times = EightChar("丙辰", "丁酉", "丙子", "甲午").get_solar_times(1900, 2024);
+            REQUIRE(times.size() == 2);
+            CHECK(times[0].to_string() == "1916年10月6日 12:00:00");
+            CHECK(times[1].to_string() == "1976年9月21日 12:00:00");
+        }
+
+        SUBCASE("并行结果与串行一致") {
+            const EightChar eight_char("甲子", "丙寅", "甲子", "甲子");
+            const std::vector<SolarTime> a = eight_char.get_solar_times(1, 9999);
+            const std::vector<SolarTime> b = eight_char.get_solar_times(1, 9999, true);
+            REQUIRE(a.size() == b.size());
+            for (size_t i = 0; i < a.size(); i++) {
+                CHECK(a[i].equals(b[i]));
+            }
+        }
+    }
+
+    TEST_CASE("按调用选择计算接口") {
+        SUBCASE("晚子时日柱") {
+            const LunarHour hour = SolarTime::from_ymd_hms(2024, 1, 1, 23, 30, 0).get_lunar_hour();
+            const LunarSect2EightCharProvider sect2;
+            const EightChar a = hour.get_eight_char();
+            const EightChar b = hour.get_eight_char(sect2);
+            // 默认晚子时日柱算第二天，流派2算当天
+            CHECK(a.get_day().next(-1).get_index() == b.get_day().get_index());
+            CHECK(a.get_hour().get_index() == b.get_hour().get_index());
+            // 全局接口不受影响
+            CHECK(hour.get_eight_char().to_string() == a.to_string());
+        }
+
+        SUBCASE("童限") {
+            const SolarTime birth_time = SolarTime::from_ymd_hms(1994, 4, 5, 7, 0, 0);
+            const LunarSect2ChildLimitProvider sect2;
+            const ChildLimit a = ChildLimit::from_solar_time(birth_time, Gender::MAN);
+            const ChildLimit b = ChildLimit::from_solar_time(birth_time, Gender::MAN, ProviderContext(nullptr, &sect2));
+            const ChildLimit c = ChildLimit::from_solar_time(birth_time, Gender::MAN, ProviderContext());
+            CHECK(a.get_year_count() == c.get_year_count());
+            CHECK(a.get_month_count() == c.get_month_count());
+            CHECK(a.get_eight_char().to_string() == b.get_eight_char().to_string());
+        }
+    }
+}
+
@@ -0,0 +1,80 @@
+// 八字排盘微基准
+//
+// 比较逐个 pai_pan_solar（含大运 / 只排四柱）与批量 batch_pai_pan（单线程 / 多线程）的单盘耗时，
+// 以及由时间戳直接求四柱的批量内核，并测量百年逐日流日区间。
+//
+// 用法:
+//   ba_zi_benchmark [次数] [线程数]   默认20000次，线程数默认按硬件并发数
+import ZhouYi.BaZiController;
+import ZhouYi.BaZiBase.Kernel;
+import fmt;
+import std;
+
+using namespace ZhouYi::BaZiController;
+using namespace std;
+
+template <typename F>
+void bench(const string_view name, const int n, F &&f) {
+    long long sum = 0;
+    const auto start = chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+        sum += f(i);
+    }
+    const auto elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    // 输出sum，避免循环被优化掉
+    fmt::println("{:<24} {:>12.1f} ns/次  (校验和 {})", name, elapsed / n, sum);
+}
+
+int main(int argc, char* argv[]) {
+    const int n = argc > 1 ? stoi(argv[1]) : 20000;
+    const unsigned threads = argc > 2 ? static_cast<unsigned>(stoi(argv[2])) : 0;
+
+    // 1950 ~ 2049 年范围内取样，按出生时间排序
+    vector<BatchRequest> requests;
+    requests.reserve(n);
+    for (int i = 0; i < n; i++) {
+        requests.push_back({1950 + i * 100 / n, i % 12 + 1, i % 28 + 1, i % 24, 0, i % 2 == 0});
+    }
+
+    bench("pai_pan_solar", n, [&](const int i) {
+        const auto& r = requests[i];
+        return static_cast<long long>(pai_pan_solar(r.year, r.month, r.day, r.hour, r.minute, r.is_male).birth_year);
+    });
+    bench("pai_pan_solar_si_zhu", n, [&](const int i) {
+        const auto& r = requests[i];
+        return static_cast<long long>(
+            pai_pan_solar(r.year, r.month, r.day, r.hour, r.minute, r.is_male, PaiPanPart::SiZhu).birth_year);
+    });
+
+    vector<optional<BaZiResult>> results(requests.size());
+    bench("batch_pai_pan_1_thread", 1, [&](const int) {
+        batch_pai_pan(requests, results);
+        return static_cast<long long>(results.back()->birth_year);
+    });
+    bench("batch_pai_pan_parallel", 1, [&](const int) {
+        batch_pai_pan(requests, results, BatchOptions{.thread_count = threads});
+        return static_cast<long long>(results.back()->birth_year);
+    });
+
+    // 四柱内核：同一批请求换成民用秒数（节气表构建不计入）
+    const auto table = ZhouYi::BaZiBase::JieQiTable::build(1950, 2049);
+    vector<int64_t> seconds;
+    seconds.reserve(requests.size());
+    for (const auto& r : requests) {
+        seconds.push_back(ZhouYi::BaZiBase::to_civil_seconds(r.year, r.month, r.day, r.hour, r.minute));
+    }
+    vector<ZhouYi::BaZiBase::SiZhuIndex> si_zhu(seconds.size());
+    bench(ZhouYi::BaZiBase::si_zhu_kernel_simd() ? "compute_si_zhu_avx2" : "compute_si_zhu", 1, [&](const int) {
+        ZhouYi::BaZiBase::compute_si_zhu(seconds, table, si_zhu);
+        return static_cast<long long>(si_zhu.back().day);
+    });
+
+    // 百年逐日流日（约 36500 天，复用同一缓冲区）
+    const auto natal = pai_pan_solar(1990, 5, 20, 8, 30, true, PaiPanPart::SiZhu);
+    vector<LiuRi> liu_ri;
+    bench("liu_ri_range_100y", 10, [&](const int) {
+        natal.liu_ri_range({2000, 1, 1}, 36525, liu_ri);
+        return static_cast<long long>(liu_ri.back().pillar.to_sixty_cycle_index());
+    });
+    return 0;
+}
@@ -0,0 +1,75 @@
+// 农历月表生成与校验工具
+//
+// 用寿星天文历（不查表）逐月计算 LunarTable::MIN_YEAR ~ LunarTable::MAX_YEAR 的农历数据，
+// 输出 LunarTable::DATA 的源码，并与当前编译进库的表逐项比对。
+//
+// 用法:
+//   lunar_table_generator          校验，不一致时返回1
+//   lunar_table_generator --print  额外输出生成的表源码
+import ZhouYi.tyme;
+import fmt;
+import std;
+
+using namespace tyme;
+using namespace std;
+
+int main(int argc, char* argv[]) {
+    const bool print = argc > 1 && string_view(argv[1]) == "--print";
+    vector<uint32_t> data;
+    int errors = 0;
+
+    for (int year = LunarTable::MIN_YEAR; year <= LunarTable::MAX_YEAR; year++) {
+        const int leap_month = LunarYear::from_year(year).get_leap_month();
+        const LunarMonth first = LunarMonth(year, 1, false);
+        const int first_day = static_cast<int>(first.get_first_julian_day().get_day() - JulianDay::J2000);
+
+        uint32_t big_months = 0;
+        int expect_first_day = first_day;
+        for (int index = 0, count = leap_month > 0 ? 13 : 12; index < count; index++) {
+            int month = index + 1;
+            if (leap_month > 0 && index >= leap_month) {
+                month = index == leap_month ? -leap_month : index;
+            }
+            const LunarMonth m = LunarMonth(year, month, false);
+            const int day = static_cast<int>(m.get_first_julian_day().get_day() - JulianDay::J2000);
+            if (day != expect_first_day) {
+                fmt::print("农历{}年索引{}: 初一不连续 {} != {}\n", year, index, day, expect_first_day);
+                errors++;
+            }
+            if (m.get_day_count() == 30) {
+                big_months |= 1u << index;
+            }
+
+            if (LunarTable::get_first_day(year, index) != day || LunarTable::get_day_count(year, index) != m.get_day_count()) {
+                fmt::print("农历{}年索引{}: 表 {}/{} 寿星 {}/{}\n", year, index,
+                    LunarTable::get_first_day(year, index), LunarTable::get_day_count(year, index),
+                    day, m.get_day_count());
+                errors++;
+            }
+            expect_first_day = day + m.get_day_count();
+        }
+
+        const uint32_t entry = LunarTable::encode(year, first_day, leap_month, big_months);
+        if (entry != LunarTable::DATA[year - LunarTable::MIN_YEAR] || LunarTable::get_leap_month(year) != leap_month) {
+            fmt::print("农历{}年: 表项 {:#010x} 应为 {:#010x}\n", year, LunarTable::DATA[year - LunarTable::MIN_YEAR], entry);
+            errors++;
+        }
+        data.push_back(entry);
+    }
+
+    if (print) {
+        fmt::print("    const uint32_t LunarTable::DATA[] = {{\n");
+        for (size_t i = 0; i < data.size(); i++) {
+            fmt::print("{}{:#010x}{}", i % 8 == 0 ? "        " : " ", data[i],
+                i + 1 == data.size() ? "\n" : (i % 8 == 7 ? ",\n" : ","));
+        }
+        fmt::print("    }};\n");
+    }
+
+    if (errors > 0) {
+        fmt::print("❌ 农历月表与寿星天文历不一致：{}处\n", errors);
+        return 1;
+    }
+    fmt::print("✅ 农历月表校验通过（{}-{}年）\n", LunarTable::MIN_YEAR, LunarTable::MAX_YEAR);
+    return 0;
+}
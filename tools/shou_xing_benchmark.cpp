@@ -0,0 +1,37 @@
+// 寿星天文历微基准
+//
+// 统计 e_lon/m_lon 全级数求和以及定气、定朔的单次耗时，
+// 用于比较 ZHOUYI_SHOUXING_AVX2 开启前后的性能。
+//
+// 用法:
+//   shou_xing_benchmark [次数]   默认100000次
+import ZhouYi.tyme.util;
+import fmt;
+import std;
+
+using namespace tyme::util;
+using namespace std;
+
+template <typename F>
+void bench(const string_view name, const int n, F &&f) {
+    double sum = 0;
+    const auto start = chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+        sum += f(i);
+    }
+    const auto elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    // 输出sum，避免循环被优化掉
+    fmt::println("{:<12} {:>10.1f} ns/次  (校验和 {:.6f})", name, elapsed / n, sum);
+}
+
+int main(int argc, char* argv[]) {
+    const int n = argc > 1 ? stoi(argv[1]) : 100000;
+
+    fmt::println("SIMD: {}, 次数: {}", ShouXingUtil::SIMD ? "AVX2" : "标量", n);
+    // 1900 ~ 2100 年范围内取样，t为儒略世纪/千年数
+    bench("e_lon", n, [n](const int i) { return ShouXingUtil::e_lon(-0.1 + 0.2 * i / n, -1); });
+    bench("m_lon", n, [n](const int i) { return ShouXingUtil::m_lon(-1 + 2.0 * i / n, -1); });
+    bench("calc_qi", n, [n](const int i) { return ShouXingUtil::calc_qi(-36525 + 73050.0 * i / n); });
+    bench("calc_shuo", n, [n](const int i) { return ShouXingUtil::calc_shuo(-36525 + 73050.0 * i / n); });
+    return 0;
+}
@@ -0,0 +1,124 @@
+// 紫微斗数排盘微基准
+//
+// 比较 pai_pan_solar（生成带字符串的 ZiWeiResult）与紧凑命盘 ZiWeiChart 的
+// 单次耗时和堆分配次数，并测量十年逐日运限时间线。本工具替换了全局 operator new 以统计分配。
+//
+// 用法:
+//   zi_wei_benchmark [次数]   默认20000次
+import ZhouYi.ZiWei;
+import ZhouYi.ZiWei.Chart;
+import ZhouYi.ZiWei.ChartTable;
+import ZhouYi.ZiWei.Timeline;
+import ZhouYi.ZiWei.Statistics;
+import ZhouYi.ZiWei.Batch;
+import ZhouYi.ZiWei.Render;
+import ZhouYi.tyme;
+import fmt;
+import std;
+
+using namespace ZhouYi::ZiWei;
+using namespace std;
+
+namespace {
+    atomic<size_t> allocation_count{0};
+}
+
+void* operator new(size_t size) {
+    allocation_count.fetch_add(1, memory_order_relaxed);
+    if (void* p = malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+template <typename F>
+void bench(const string_view name, const int n, F &&f) {
+    long long sum = 0;
+    const size_t allocations = allocation_count.load();
+    const auto start = chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+        sum += f(i);
+    }
+    const auto elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    const double per_call = static_cast<double>(allocation_count.load() - allocations) / n;
+    // 输出sum，避免循环被优化掉
+    fmt::println("{:<20} {:>10.1f} ns/次  {:>6.1f} 次分配/次  (校验和 {})", name, elapsed / n, per_call, sum);
+}
+
+int main(int argc, char* argv[]) {
+    const int n = argc > 1 ? stoi(argv[1]) : 20000;
+
+    // 1950 ~ 2049 年范围内取样
+    auto solar_input = [](const int i) {
+        return array<int, 4>{1950 + i % 100, 1 + i % 12, 1 + i % 28, i % 24};
+    };
+    // 以与表长互素的步长遍历查表键
+    auto chart_key = [](const int i) {
+        return ZiWeiChartKey::from_index(static_cast<size_t>(i) * 7919 % ZiWeiChartKey::COUNT);
+    };
+
+    fmt::println("次数: {}", n);
+    bench("pai_pan_solar", n, [&](const int i) {
+        auto [y, m, d, h] = solar_input(i);
+        return pai_pan_solar(y, m, d, h, true).zi_wei_index;
+    });
+    bench("compute_chart_row", n, [&](const int i) {
+        return compute_chart_row(chart_key(i)).zi_wei_index;
+    });
+    bench("ZiWeiChart::from_key", n, [&](const int i) {
+        return ZiWeiChart::from_key(chart_key(i)).palaces[0].star_count;
+    });
+
+    // 命盘输出（复用缓冲区）与 to_string 对比
+    const auto rendered = pai_pan_solar(1990, 5, 20, 8, true);
+    fmt::memory_buffer buffer;
+    bench("ZiWeiResult::to_string", n, [&](const int) {
+        return static_cast<long long>(rendered.to_string().size());
+    });
+    bench("render_text", n, [&](const int) {
+        buffer.clear();
+        render_text(buffer, rendered);
+        return static_cast<long long>(buffer.size());
+    });
+    bench("render_json", n, [&](const int) {
+        buffer.clear();
+        render_json(buffer, rendered);
+        return static_cast<long long>(buffer.size());
+    });
+
+    // 批量排盘（每批 1000 盘，按日期顺序，每日 12 时辰）
+    vector<BirthInput> births;
+    for (int i = 0; i < 1000; i++) {
+        const auto day = tyme::SolarDay::from_ymd(1990, 1, 1).next(i / 12);
+        births.push_back({day.get_year(), day.get_month(), day.get_day(), i % 12 * 2, i % 2 == 0});
+    }
+    ZiWeiBatchColumns columns;
+    bench("batch_pai_pan_1000", max(1, n / 1000), [&](const int) {
+        batch_pai_pan(births, columns);
+        return static_cast<long long>(columns.chart_key.back());
+    });
+
+    // 十年逐日运限（每次约 3650 步）
+    const auto natal = pai_pan_solar(1990, 5, 20, 8, true);
+    bench("timeline_10y_daily", max(1, n / 1000), [&](const int) {
+        auto steps = generate_horoscope_timeline(
+            natal, tyme::SolarDay::from_ymd(2025, 1, 1), tyme::SolarDay::from_ymd(2034, 12, 31));
+        return static_cast<long long>(steps.size());
+    });
+
+    // 一年出生日期的格局统计（365 日 × 12 时辰）
+    bench("ge_ju_statistics_1y", 1, [&](const int) {
+        auto stats = collect_ge_ju_statistics(
+            tyme::SolarDay::from_ymd(2000, 1, 1), tyme::SolarDay::from_ymd(2000, 12, 31));
+        return static_cast<long long>(stats.distinct_chart_count);
+    });
+    return 0;
+}
@@ -0,0 +1,51 @@
+// 紫微斗数本命盘表生成与校验工具
+//
+// 穷举 ZiWeiChartKey 全域（年干支 × 农历月含闰 × 农历日 × 时支）计算本命盘，
+// 写出可内存映射的二进制表，再映射回来逐行比对，并抽样比对公历排盘结果。
+//
+// 用法:
+//   zi_wei_table_generator [输出路径]   默认 zi_wei_chart.bin，不一致时返回1
+import ZhouYi.ZiWei;
+import ZhouYi.ZiWei.ChartTable;
+import fmt;
+import std;
+
+using namespace ZhouYi::ZiWei;
+using namespace std;
+
+int main(int argc, char* argv[]) {
+    const string path = argc > 1 ? argv[1] : "zi_wei_chart.bin";
+    int errors = 0;
+
+    auto start = chrono::steady_clock::now();
+    write_chart_table(path);
+    auto elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    fmt::print("已生成 {} 行 -> {} ({:.2f}s)\n", ZiWeiChartKey::COUNT, path, elapsed);
+
+    const ZiWeiChartTable table(path);
+    for (size_t i = 0; i < ZiWeiChartKey::COUNT; ++i) {
+        const auto key = ZiWeiChartKey::from_index(i);
+        const auto expect = compute_chart_row(key);
+        if (key.to_index() != i || memcmp(&table.get_row(key), &expect, sizeof(expect)) != 0) {
+            fmt::print("第{}行不一致\n", i);
+            errors++;
+        }
+    }
+
+    // 公历排盘抽样：查表结果与实时安星逐宫比对
+    for (int year = 1900; year <= 2100; year += 7) {
+        for (int month = 1; month <= 12; month += 5) {
+            for (int hour = 0; hour < 24; hour += 5) {
+                auto computed = pai_pan_solar(year, month, 15, hour, true);
+                auto looked_up = pai_pan_solar(year, month, 15, hour, true, table);
+                if (computed.to_string() != looked_up.to_string()) {
+                    fmt::print("{}-{}-15 {}时: 查表排盘与实时排盘不一致\n", year, month, hour);
+                    errors++;
+                }
+            }
+        }
+    }
+
+    fmt::print("{}\n", errors == 0 ? "校验通过" : fmt::format("发现 {} 处不一致", errors));
+    return errors == 0 ? 0 : 1;
+}